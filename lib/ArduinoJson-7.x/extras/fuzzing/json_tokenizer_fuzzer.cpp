@@ -0,0 +1,27 @@
+#include <ArduinoJson.h>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  auto tokenizer = makeJsonTokenizer(data, size);
+  bool skip = false;
+  for (;;) {
+    switch (tokenizer.next()) {
+      case JsonToken::Key:
+        // skip every other value
+        if (skip)
+          tokenizer.skip();
+        skip = !skip;
+        break;
+
+      case JsonToken::Number:
+        tokenizer.as<double>();
+        break;
+
+      case JsonToken::End:
+      case JsonToken::Error:
+        return 0;
+
+      default:
+        break;
+    }
+  }
+}
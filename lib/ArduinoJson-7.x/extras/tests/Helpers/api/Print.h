@@ -15,6 +15,8 @@ class Print {
   virtual size_t write(uint8_t) = 0;
   virtual size_t write(const uint8_t* buffer, size_t size) = 0;
 
+  virtual void flush() {}
+
   size_t write(const char* str) {
     if (!str)
       return 0;
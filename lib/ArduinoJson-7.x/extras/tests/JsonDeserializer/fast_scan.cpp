@@ -0,0 +1,210 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <chrono>
+#include <string>
+
+#include "CustomReader.hpp"
+
+using ArduinoJson::detail::findNonSpace;
+using ArduinoJson::detail::findStringSpecialChar;
+
+// Parses the input with the three kinds of readers:
+// - null-terminated input in RAM (scanned one char at a time),
+// - input in RAM with a size (scanned several chars at a time),
+// - a stream (read one char at a time),
+// and checks that they all give the same result.
+static std::string parseAll(const std::string& input,
+                            JsonVariantConst filter = JsonVariantConst()) {
+  auto parse = [&](JsonDocument& doc, DeserializationError err) {
+    std::string json;
+    if (!err)
+      serializeJson(doc, json);
+    return std::string(err.c_str()) + " " + json;
+  };
+  JsonDocument everything;
+  everything.set(true);
+  DeserializationOption::Filter options(
+      filter.isNull() ? everything.as<JsonVariantConst>() : filter);
+
+  JsonDocument doc1, doc2, doc3;
+  std::string nullTerminated =
+      parse(doc1, deserializeJson(doc1, input.c_str(), options));
+  std::string bounded = parse(
+      doc2, deserializeJson(doc2, input.c_str(), input.size(), options));
+  CustomReader reader(input.c_str());
+  std::string stream = parse(doc3, deserializeJson(doc3, reader, options));
+
+  CHECK(bounded == stream);
+  CHECK(nullTerminated == stream);
+  return stream;
+}
+
+TEST_CASE("findStringSpecialChar()") {
+  std::string s(100, 'a');
+
+  SECTION("finds the special chars at every offset") {
+    const char specials[] = {'"', '\'', '\\', '\n', '\x01', '\x1f', '\0'};
+    for (char special : specials) {
+      for (size_t i = 0; i < 40; i++) {
+        std::string t = s;
+        t[i] = special;
+        CHECK(findStringSpecialChar(t.data(), t.data() + t.size()) ==
+              t.data() + i);
+      }
+    }
+  }
+
+  SECTION("ignores non-ASCII chars") {
+    std::string t = "caf\xc3\xa9 \xe2\x82\xac\xff\x80\x7f 0123456789\"";
+    CHECK(findStringSpecialChar(t.data(), t.data() + t.size()) ==
+          t.data() + t.size() - 1);
+  }
+
+  SECTION("stops at the end") {
+    CHECK(findStringSpecialChar(s.data(), s.data() + 37) == s.data() + 37);
+  }
+
+  SECTION("null-terminated") {
+    CHECK(findStringSpecialChar(s.c_str(), nullptr) == s.c_str() + s.size());
+  }
+}
+
+TEST_CASE("findNonSpace()") {
+  std::string s = std::string(40, ' ') + "x";
+
+  SECTION("finds the first non-space at every offset") {
+    for (size_t i = 0; i < 40; i++) {
+      std::string t = std::string(i, ' ') + "\t\r\n" + std::string(40, 'x');
+      CHECK(findNonSpace(t.data(), t.data() + t.size()) == t.data() + i + 3);
+    }
+  }
+
+  SECTION("stops at the end") {
+    CHECK(findNonSpace(s.data(), s.data() + 37) == s.data() + 37);
+  }
+
+  SECTION("null-terminated") {
+    CHECK(findNonSpace(s.c_str(), nullptr) == s.c_str() + 40);
+  }
+}
+
+TEST_CASE("deserializeJson() gives the same result with every reader") {
+  SECTION("special chars at every offset") {
+    const char* specials[] = {"\\\"", "\\\\", "\\n", "\\u00e9", "'", "\\/"};
+    for (const char* special : specials) {
+      for (size_t i = 0; i < 40; i++) {
+        std::string value = std::string(i, 'a') + special + std::string(i, 'b');
+        std::string output = parseAll("[\"" + value + "\"]");
+        CHECK(output.substr(0, 3) == "Ok ");
+      }
+    }
+  }
+
+  SECTION("long strings") {
+    std::string value;
+    for (int i = 0; value.size() < 1000; i++)
+      value += "Hello \\\"world\\\" " + std::to_string(i) + " caf\xc3\xa9 ";
+    REQUIRE(parseAll("{\"key\":\"" + value + "\"}").substr(0, 3) == "Ok ");
+    REQUIRE(parseAll("{'key':'" + value + "'}").substr(0, 3) == "Ok ");
+  }
+
+  SECTION("spaces of every length") {
+    for (size_t i = 0; i < 40; i++) {
+      std::string spaces = std::string(i, ' ') + "\r\n" + std::string(i, '\t');
+      std::string output =
+          parseAll(spaces + "{" + spaces + "\"a\"" + spaces + ":" + spaces +
+                   "[1," + spaces + "true]" + spaces + "}" + spaces);
+      CHECK(output == "Ok {\"a\":[1,true]}");
+    }
+  }
+
+  SECTION("control chars in strings") {
+    for (size_t i = 0; i < 20; i++) {
+      std::string output =
+          parseAll("[\"" + std::string(i, 'a') + "\x01" + "\tz\"]");
+      CHECK(output.substr(0, 3) == "Ok ");
+    }
+  }
+
+  SECTION("every truncation") {
+    std::string input =
+        "{\n  \"name\" : \"Hello \\\"world\\\" \\u00e9\",\n"
+        "  'list' : [ \"abcdefghijklmnopqrstuvwxyz\" , 42 ]\n}\n";
+    for (size_t n = 0; n <= input.size(); n++)
+      parseAll(input.substr(0, n));
+  }
+
+  SECTION("skipped strings") {
+    JsonDocument filter;
+    filter["b"] = true;
+    for (size_t i = 0; i < 40; i++) {
+      std::string value = std::string(i, 'x') + "\\\"" + std::string(i, 'y');
+      std::string output = parseAll(
+          "{\"a\":\"" + value + "\",  \"b\":\"" + value + "\"}", filter);
+      CHECK(output.substr(0, 9) == "Ok {\"b\":\"");
+    }
+    CHECK(parseAll("{\"a\":\"abc\\", filter) == "IncompleteInput ");
+  }
+
+  SECTION("stops at a null char in the middle of the input") {
+    std::string input = "[\"abcdefghijklmnopqrstuvwxyz\",  " +
+                        std::string(1, '\0') + "  \"abc\"]";
+    JsonDocument doc;
+    REQUIRE(deserializeJson(doc, input.data(), input.size()) ==
+            DeserializationError::IncompleteInput);
+  }
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("fast scan benchmark", "[.benchmark]") {
+  // a pretty-printed log with long messages
+  JsonDocument source;
+  JsonArray entries = source["log"]["entries"].to<JsonArray>();
+  for (int i = 0; i < 50; i++) {
+    JsonObject entry = entries.add<JsonObject>();
+    entry["time"] = 1718960000 + i;
+    std::string message = "[" + std::to_string(i) + "] ";
+    while (message.size() < 400)
+      message += "Weather update failed: HTTP error -1, retrying in 60 s. ";
+    entry["message"] = message;
+  }
+  std::string json;
+  serializeJsonPretty(source, json);
+  const int rounds = 500;
+  using microseconds = std::chrono::duration<double, std::micro>;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    JsonDocument doc;
+    CustomReader reader(json.c_str());
+    REQUIRE(deserializeJson(doc, reader) == DeserializationError::Ok);
+  }
+  auto streamTime = microseconds(std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    JsonDocument doc;
+    REQUIRE(deserializeJson(doc, json.c_str()) == DeserializationError::Ok);
+  }
+  auto nullTerminatedTime =
+      microseconds(std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    JsonDocument doc;
+    REQUIRE(deserializeJson(doc, json.c_str(), json.size()) ==
+            DeserializationError::Ok);
+  }
+  auto boundedTime = microseconds(std::chrono::steady_clock::now() - start);
+
+  double megabytes = double(json.size()) * rounds / 1e6;
+  WARN("stream: " << megabytes / streamTime.count() * 1e6 << " MB/s");
+  WARN("null-terminated: " << megabytes / nullTerminatedTime.count() * 1e6
+                           << " MB/s");
+  WARN("bounded: " << megabytes / boundedTime.count() * 1e6 << " MB/s");
+}
@@ -0,0 +1,287 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+struct Weather {
+  float lon;
+  int weatherId;
+  char description[16];
+  double temp;
+  uint8_t humidity;
+  long sunrise;
+  bool daylight;
+  std::string name;
+};
+
+static Weather staticWeather;
+
+// built at compile time
+static constexpr JsonField staticFields[] = {
+    {"/coord/lon", staticWeather.lon},
+    {"/name", staticWeather.name},
+};
+
+TEST_CASE("deserializeJson(JsonField[])") {
+  Weather w = {};
+  const JsonField fields[] = {
+      {"/coord/lon", w.lon},
+      {"/weather/0/id", w.weatherId},
+      {"/weather/0/description", w.description},
+      {"/main/temp", w.temp},
+      {"/main/humidity", w.humidity},
+      {"/sys/sunrise", w.sunrise},
+      {"/daylight", w.daylight},
+      {"/name", w.name},
+  };
+
+  SECTION("stores the values of the fields") {
+    auto err = deserializeJson(fields,
+                               "{\"coord\":{\"lon\":6.5,\"lat\":46.47},"
+                               "\"weather\":[{\"id\":800,\"main\":\"Clear\","
+                               "\"description\":\"clear sky\"}],"
+                               "\"main\":{\"temp\":21.5,\"humidity\":40},"
+                               "\"sys\":{\"sunrise\":1718940000},"
+                               "\"daylight\":true,\"name\":\"Vevey\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.lon == 6.5f);
+    REQUIRE(w.weatherId == 800);
+    REQUIRE(std::string(w.description) == "clear sky");
+    REQUIRE(w.temp == 21.5);
+    REQUIRE(w.humidity == 40);
+    REQUIRE(w.sunrise == 1718940000);
+    REQUIRE(w.daylight == true);
+    REQUIRE(w.name == "Vevey");
+  }
+
+  SECTION("missing fields keep their value") {
+    w.weatherId = 42;
+    w.name = "unchanged";
+
+    auto err = deserializeJson(fields, "{\"main\":{\"temp\":3}}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.temp == 3);
+    REQUIRE(w.weatherId == 42);
+    REQUIRE(w.name == "unchanged");
+  }
+
+  SECTION("null keeps the value") {
+    w.temp = 1.5;
+
+    auto err = deserializeJson(fields, "{\"main\":{\"temp\":null}}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.temp == 1.5);
+  }
+
+  SECTION("incompatible types keep the value") {
+    w.weatherId = 42;
+    w.name = "unchanged";
+
+    auto err = deserializeJson(
+        fields, "{\"weather\":[{\"id\":\"800\"}],\"name\":{\"a\":1}}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.weatherId == 42);
+    REQUIRE(w.name == "unchanged");
+  }
+
+  SECTION("converts numbers like as<T>()") {
+    auto err = deserializeJson(
+        fields, "{\"weather\":[{\"id\":3.7}],\"main\":{\"humidity\":300},"
+                "\"daylight\":1}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.weatherId == 3);
+    REQUIRE(w.humidity == 0);  // out of range
+    REQUIRE(w.daylight == true);
+  }
+
+  SECTION("truncates strings that don't fit in a char array") {
+    auto err = deserializeJson(
+        fields, "{\"weather\":[{\"description\":\"thunderstorm with rain\"}]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(std::string(w.description) == "thunderstorm wi");
+  }
+
+  SECTION("decodes escape sequences") {
+    auto err = deserializeJson(fields, "{\"name\":\"Gen\\u00e8ve\\n\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.name == "Gen\xC3\xA8ve\n");
+  }
+
+  SECTION("only stores the selected element") {
+    auto err = deserializeJson(
+        fields, "{\"weather\":[{\"id\":500},{\"id\":800}],\"name\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.weatherId == 500);
+    REQUIRE(w.name == "x");
+  }
+
+  SECTION("skips the other members") {
+    auto err = deserializeJson(
+        fields,
+        "{\"base\":\"stations\",\"clouds\":{\"all\":[1,{\"a\":null}]},"
+        "\"coord\":{\"lat\":1,\"lon\":2},\"name\":'single',unquoted:true}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.lon == 2);
+    REQUIRE(w.name == "single");
+  }
+
+  SECTION("skips a container where a value is expected") {
+    auto err = deserializeJson(fields, "{\"name\":[1,2],\"daylight\":true}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.daylight == true);
+  }
+
+  SECTION("skips a value where a container is expected") {
+    auto err = deserializeJson(fields, "{\"main\":42,\"daylight\":true}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.daylight == true);
+  }
+
+  SECTION("EmptyInput") {
+    REQUIRE(deserializeJson(fields, "") == DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    REQUIRE(deserializeJson(fields, "{\"main\":{\"temp\":1") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeJson(fields, "{\"other\":[1,2") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE(deserializeJson(fields, "{\"main\":{\"temp\":1]}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJson(fields, "{\"main\":{\"temp\":-}}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJson(fields, "{\"daylight\" true}") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    DeserializationOption::NestingLimit nesting(1);
+
+    REQUIRE(deserializeJson(fields, "{\"main\":{\"temp\":1}}", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJson(fields, "{\"other\":[[]]}", nesting) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJson(fields, "{\"daylight\":true}", nesting) ==
+            DeserializationError::Ok);
+  }
+
+  SECTION("input = std::string") {
+    auto err = deserializeJson(fields, std::string("{\"daylight\":true}"));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.daylight == true);
+  }
+
+  SECTION("input = std::istream") {
+    std::istringstream json("{\"main\":{\"humidity\":12}}");
+
+    auto err = deserializeJson(fields, json);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.humidity == 12);
+  }
+
+  SECTION("input = char*, size_t") {
+    char json[] = "{\"main\":{\"humidity\":12}}garbage";
+
+    auto err = deserializeJson(fields, json, 24);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(w.humidity == 12);
+  }
+
+  SECTION("root array") {
+    int second = 0;
+    const JsonField elements[] = {{"/1", second}};
+
+    auto err = deserializeJson(elements, "[1,2,3]");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(second == 2);
+  }
+
+  SECTION("constexpr fields") {
+    auto err = deserializeJson(staticFields,
+                               "{\"coord\":{\"lon\":1.5},\"name\":\"Vevey\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(staticWeather.lon == 1.5f);
+    REQUIRE(staticWeather.name == "Vevey");
+  }
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("deserializeJson(JsonField[]) benchmark", "[.benchmark]") {
+  const char* json =
+      "{\"coord\":{\"lon\":6.8590,\"lat\":46.4667},\"weather\":[{\"id\":800,"
+      "\"main\":\"Clear\",\"description\":\"clear sky\",\"icon\":\"01d\"}],"
+      "\"base\":\"stations\",\"main\":{\"temp\":21.57,\"feels_like\":21.1,"
+      "\"temp_min\":19.93,\"temp_max\":23.1,\"pressure\":1016,\"humidity\":"
+      "52,\"sea_level\":1016,\"grnd_level\":963},\"visibility\":10000,"
+      "\"wind\":{\"speed\":2.57,\"deg\":230,\"gust\":4.12},\"clouds\":{"
+      "\"all\":0},\"dt\":1718960000,\"sys\":{\"type\":2,\"id\":2000000,"
+      "\"country\":\"CH\",\"sunrise\":1718940000,\"sunset\":1718996000},"
+      "\"timezone\":7200,\"id\":2658761,\"name\":\"Vevey\",\"cod\":200}";
+  const int rounds = 100000;
+  using microseconds = std::chrono::duration<double, std::micro>;
+
+  float temp = 0, windSpeed = 0;
+  int humidity = 0, pressure = 0;
+  long sunrise = 0, sunset = 0;
+  char description[32];
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    JsonDocument doc;
+    deserializeJson(doc, json);
+    temp = doc["main"]["temp"];
+    humidity = doc["main"]["humidity"];
+    pressure = doc["main"]["pressure"];
+    windSpeed = doc["wind"]["speed"];
+    sunrise = doc["sys"]["sunrise"];
+    sunset = doc["sys"]["sunset"];
+    snprintf(description, sizeof(description), "%s",
+             doc["weather"][0]["description"] | "");
+  }
+  auto documentTime = microseconds(std::chrono::steady_clock::now() - start);
+  REQUIRE(humidity == 52);
+
+  humidity = 0;
+  const JsonField fields[] = {
+      {"/main/temp", temp},
+      {"/main/humidity", humidity},
+      {"/main/pressure", pressure},
+      {"/wind/speed", windSpeed},
+      {"/sys/sunrise", sunrise},
+      {"/sys/sunset", sunset},
+      {"/weather/0/description", description},
+  };
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++)
+    deserializeJson(fields, json);
+  auto fieldsTime = microseconds(std::chrono::steady_clock::now() - start);
+  REQUIRE(humidity == 52);
+
+  WARN("JsonDocument: " << documentTime.count() / rounds << " us/parse");
+  WARN("JsonField[]: " << fieldsTime.count() / rounds << " us/parse");
+}
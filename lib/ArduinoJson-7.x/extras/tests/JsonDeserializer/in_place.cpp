@@ -0,0 +1,171 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_DECODE_UNICODE 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::sizeofObject;
+
+static bool isInside(const char* s, const std::string& buffer) {
+  return s >= &buffer[0] && s < &buffer[0] + buffer.size();
+}
+
+TEST_CASE("deserializeJsonInPlace()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("links the strings to the input") {
+    std::string input = "{\"city\":\"Lausanne\",\"sky\":\"clear\"}";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["city"] == "Lausanne");
+    REQUIRE(doc["sky"] == "clear");
+    REQUIRE(isInside(doc["city"].as<const char*>(), input));
+    REQUIRE(isInside(doc.as<JsonObject>().begin()->key().c_str(), input));
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofObject(2)),
+                         });
+  }
+
+  SECTION("decodes the escape sequences in place") {
+    std::string input =
+        "[\"1\\\"2\\\\3\\/4\\b5\\f6\\n7\\r8\\t9\",'\\u00e4\\ud83d\\udda4!']";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "1\"2\\3/4\b5\f6\n7\r8\t9");
+    REQUIRE(doc[1] == "\xc3\xa4\xf0\x9f\x96\xa4!");
+    REQUIRE(isInside(doc[0].as<const char*>(), input));
+    REQUIRE(isInside(doc[1].as<const char*>(), input));
+  }
+
+  SECTION("empty string") {
+    std::string input = "[\"\",'']";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[\"\",\"\"]");
+  }
+
+  SECTION("copies the unquoted keys") {
+    std::string input = "{city:'Lausanne'}";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["city"] == "Lausanne");
+    REQUIRE(!isInside(doc.as<JsonObject>().begin()->key().c_str(), input));
+    REQUIRE(isInside(doc["city"].as<const char*>(), input));
+  }
+
+  SECTION("copies the strings that contain a null char") {
+    std::string input = "[\"wx\\u0000yz\"]";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0].as<std::string>() == std::string("wx\0yz", 5));
+    REQUIRE(!isInside(doc[0].as<const char*>(), input));
+  }
+
+  SECTION("input with a size") {
+    std::string input = "[\"hello\",\"world\"]garbage";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0], 17);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[\"hello\",\"world\"]");
+    REQUIRE(isInside(doc[1].as<const char*>(), input));
+  }
+
+  SECTION("filter") {
+    std::string input = "{\"name\":\"Lausanne\",\"list\":[{\"main\":\"Clouds\","
+                        "\"description\":\"few clouds\"}]}";
+    JsonDocument filter;
+    filter["list"][0]["main"] = true;
+
+    DeserializationError err = deserializeJsonInPlace(
+        doc, &input[0], DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"list\":[{\"main\":\"Clouds\"}]}");
+    REQUIRE(isInside(doc["list"][0]["main"].as<const char*>(), input));
+  }
+
+  SECTION("nesting limit") {
+    std::string input = "[[\"hello\"]]";
+
+    DeserializationError err = deserializeJsonInPlace(
+        doc, &input[0], DeserializationOption::NestingLimit(1));
+
+    REQUIRE(err == DeserializationError::TooDeep);
+  }
+
+  SECTION("incomplete input") {
+    std::string input = "{\"hello\":\"wor";
+
+    DeserializationError err = deserializeJsonInPlace(doc, &input[0]);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeJsonInPlace() behaves like deserializeJson()") {
+  const char* inputs[] = {
+      "{\"coord\":{\"lon\":6.63,\"lat\":46.52},\"weather\":[{\"id\":801,"
+      "\"main\":\"Clouds\",\"description\":\"few clouds\",\"icon\":\"02d\"}],"
+      "\"main\":{\"temp\":21.5,\"humidity\":53},\"name\":\"Lausanne\"}",
+      "  [ \"a\" , 'b' , \"\\\"c\\\"\" , { \"d\" : [ \"e\\n\" ] } ]  ",
+      "{\"k\\u00e9y\":\"v\\u00e4lue\",\"dup\":\"first\",\"dup\":\"second\"}",
+      "[\"Hello \\\"world\\\" with a string longer than sixteen chars\"]",
+      "{\"unterminated",
+      "[\"\\u12\"]",
+      "[\"\\x\"]",
+  };
+
+  for (const char* input : inputs) {
+    CAPTURE(input);
+    std::string buffer = input;
+    JsonDocument expected, actual;
+
+    DeserializationError expectedErr = deserializeJson(expected, input);
+    DeserializationError actualErr =
+        deserializeJsonInPlace(actual, &buffer[0]);
+
+    CHECK(actualErr == expectedErr);
+    if (!expectedErr)
+      CHECK(actual == expected);
+  }
+}
+
+TEST_CASE("deserializeJsonInPlace() uses less memory") {
+  SpyingAllocator copySpy, inPlaceSpy;
+  std::string input =
+      "{\"weather\":[{\"main\":\"Clouds\",\"description\":\"few clouds\","
+      "\"icon\":\"02d\"}],\"name\":\"Lausanne\",\"country\":\"CH\"}";
+  std::string buffer = input;
+  JsonDocument copy(&copySpy), inPlace(&inPlaceSpy);
+
+  deserializeJson(copy, input);
+  deserializeJsonInPlace(inPlace, &buffer[0]);
+
+  REQUIRE(inPlace == copy);
+  REQUIRE(inPlaceSpy.allocatedBytes() < copySpy.allocatedBytes());
+  // no string, only the 13 slots: 3 + 3 members, and 1 array element
+  REQUIRE(inPlaceSpy.log() ==
+          AllocatorLog{
+              Allocate(sizeofPool()),
+              Reallocate(sizeofPool(), sizeofPool(13)),
+          });
+}
@@ -0,0 +1,316 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+// Returns the tokens as a string, for example "{k:n,k:[s]}"
+template <typename TTokenizer>
+static std::string tokens(TTokenizer& tokenizer) {
+  std::string result;
+  for (;;) {
+    switch (tokenizer.next()) {
+      case JsonToken::BeginObject:
+        result += "{";
+        break;
+      case JsonToken::EndObject:
+        result += "}";
+        break;
+      case JsonToken::BeginArray:
+        result += "[";
+        break;
+      case JsonToken::EndArray:
+        result += "]";
+        break;
+      case JsonToken::Key:
+        result += "k:";
+        break;
+      case JsonToken::String:
+        result += "s";
+        break;
+      case JsonToken::Number:
+        result += "n";
+        break;
+      case JsonToken::Boolean:
+        result += "b";
+        break;
+      case JsonToken::Null:
+        result += "0";
+        break;
+      case JsonToken::Error:
+        result += "!";
+        return result;
+      default:
+        return result;
+    }
+  }
+}
+
+static std::string tokens(const char* json) {
+  auto tokenizer = makeJsonTokenizer(json);
+  return tokens(tokenizer);
+}
+
+static DeserializationError errorOf(const char* json) {
+  auto tokenizer = makeJsonTokenizer(json);
+  tokens(tokenizer);
+  return tokenizer.error();
+}
+
+TEST_CASE("JsonTokenizer") {
+  SECTION("returns the tokens in order") {
+    REQUIRE(tokens("{\"a\":1,\"b\":[true,null,\"x\"],\"c\":{}}") ==
+            "{k:nk:[b0s]k:{}}");
+  }
+
+  SECTION("root values") {
+    REQUIRE(tokens("42") == "n");
+    REQUIRE(tokens("\"hello\"") == "s");
+    REQUIRE(tokens("[]") == "[]");
+    REQUIRE(tokens("  true  ") == "b");
+  }
+
+  SECTION("the values of the tokens") {
+    auto tokenizer = makeJsonTokenizer(
+        "{\"name\":\"Gen\\u00e8ve\",\"temp\":21.5,\"id\":800,\"day\":true}");
+
+    REQUIRE(tokenizer.token() == JsonToken::None);
+    REQUIRE(tokenizer.next() == JsonToken::BeginObject);
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.string() == std::string("name"));
+    REQUIRE(tokenizer.size() == 4);
+    REQUIRE(tokenizer.next() == JsonToken::String);
+    REQUIRE(tokenizer.string() == std::string("Gen\xC3\xA8ve"));
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.next() == JsonToken::Number);
+    REQUIRE(tokenizer.string() == std::string("21.5"));
+    REQUIRE(tokenizer.as<float>() == 21.5f);
+    REQUIRE(tokenizer.as<int>() == 21);
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.next() == JsonToken::Number);
+    REQUIRE(tokenizer.as<int>() == 800);
+    REQUIRE(tokenizer.as<uint8_t>() == 0);  // out of range
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.next() == JsonToken::Boolean);
+    REQUIRE(tokenizer.as<bool>() == true);
+    REQUIRE(tokenizer.as<int>() == 1);
+    REQUIRE(tokenizer.next() == JsonToken::EndObject);
+    REQUIRE(tokenizer.next() == JsonToken::End);
+    REQUIRE(tokenizer.next() == JsonToken::End);
+    REQUIRE(tokenizer.error() == DeserializationError::Ok);
+  }
+
+  SECTION("depth() and inObject()") {
+    auto tokenizer = makeJsonTokenizer("{\"a\":[1]}");
+
+    REQUIRE(tokenizer.depth() == 0);
+    tokenizer.next();  // {
+    REQUIRE(tokenizer.depth() == 1);
+    REQUIRE(tokenizer.inObject() == true);
+    tokenizer.next();  // "a"
+    tokenizer.next();  // [
+    REQUIRE(tokenizer.depth() == 2);
+    REQUIRE(tokenizer.inObject() == false);
+    tokenizer.next();  // 1
+    REQUIRE(tokenizer.depth() == 2);
+    tokenizer.next();  // ]
+    REQUIRE(tokenizer.depth() == 1);
+    REQUIRE(tokenizer.inObject() == true);
+    tokenizer.next();  // }
+    REQUIRE(tokenizer.depth() == 0);
+  }
+
+  SECTION("skip() after a key skips the value") {
+    auto tokenizer =
+        makeJsonTokenizer("{\"a\":{\"b\":[1,{\"c\":2}]},\"d\":3,\"e\":4}");
+
+    tokenizer.next();  // {
+    tokenizer.next();  // "a"
+    REQUIRE(tokenizer.skip() == DeserializationError::Ok);
+    REQUIRE(tokenizer.token() == JsonToken::EndObject);
+    REQUIRE(tokenizer.depth() == 1);
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.string() == std::string("d"));
+    REQUIRE(tokenizer.skip() == DeserializationError::Ok);
+    REQUIRE(tokenizer.token() == JsonToken::Number);
+    REQUIRE(tokenizer.next() == JsonToken::Key);
+    REQUIRE(tokenizer.string() == std::string("e"));
+  }
+
+  SECTION("skip() after BeginArray skips the rest of the array") {
+    auto tokenizer = makeJsonTokenizer("[[1,[2]],3]");
+
+    tokenizer.next();  // [
+    tokenizer.next();  // [
+    REQUIRE(tokenizer.skip() == DeserializationError::Ok);
+    REQUIRE(tokenizer.token() == JsonToken::EndArray);
+    REQUIRE(tokenizer.next() == JsonToken::Number);
+    REQUIRE(tokenizer.as<int>() == 3);
+  }
+
+  SECTION("skip() reports errors") {
+    auto tokenizer = makeJsonTokenizer("{\"a\":[1,2");
+
+    tokenizer.next();  // {
+    tokenizer.next();  // "a"
+    REQUIRE(tokenizer.skip() == DeserializationError::IncompleteInput);
+    REQUIRE(tokenizer.token() == JsonToken::Error);
+  }
+
+  SECTION("truncates long strings") {
+    auto tokenizer = makeJsonTokenizer<8>("[\"0123456789\",\"0123\"]");
+
+    tokenizer.next();
+    REQUIRE(tokenizer.next() == JsonToken::String);
+    REQUIRE(tokenizer.string() == std::string("0123456"));
+    REQUIRE(tokenizer.truncated() == true);
+    REQUIRE(tokenizer.next() == JsonToken::String);
+    REQUIRE(tokenizer.string() == std::string("0123"));
+    REQUIRE(tokenizer.truncated() == false);
+  }
+
+  SECTION("single quotes and unquoted keys") {
+    REQUIRE(tokens("{key:'value'}") == "{k:s}");
+  }
+
+  SECTION("stops after the root value") {
+    REQUIRE(tokens("{}garbage") == "{}");
+  }
+
+  SECTION("EmptyInput") {
+    REQUIRE(errorOf("") == DeserializationError::EmptyInput);
+    REQUIRE(errorOf("  ") == DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    REQUIRE(errorOf("{") == DeserializationError::IncompleteInput);
+    REQUIRE(errorOf("{\"a\"") == DeserializationError::IncompleteInput);
+    REQUIRE(errorOf("{\"a\":") == DeserializationError::IncompleteInput);
+    REQUIRE(errorOf("[1,") == DeserializationError::IncompleteInput);
+    REQUIRE(errorOf("\"abc") == DeserializationError::IncompleteInput);
+    REQUIRE(errorOf("tru") == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE(errorOf("[1 2]") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("[1,]") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("[,1]") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("{\"a\":1,}") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("{\"a\" 1}") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("{\"a\":1]") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("[1}") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("nul!") == DeserializationError::InvalidInput);
+    REQUIRE(errorOf("\"\\x\"") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    DeserializationOption::NestingLimit nesting(2);
+
+    auto ok = makeJsonTokenizer("[[1]]", nesting);
+    REQUIRE(tokens(ok) == "[[n]]");
+
+    auto tooDeep = makeJsonTokenizer("[[[1]]]", nesting);
+    REQUIRE(tokens(tooDeep) == "[[!");
+    REQUIRE(tooDeep.error() == DeserializationError::TooDeep);
+  }
+
+  SECTION("same errors as deserializeJson()") {
+    const char* inputs[] = {
+        "",        "{",      "[1,",       "[1 2]",     "{\"a\":1,}",
+        "[[[[1]]]]", "nul!", "\"\\u00\"", "{a:1}",     "[-]",
+        "[1e]",    "{\"a\":[1,{\"b\":2}]}",
+    };
+    DeserializationOption::NestingLimit nesting(3);
+    for (auto input : inputs) {
+      JsonDocument doc;
+      auto expected = deserializeJson(doc, input, nesting);
+      auto tokenizer = makeJsonTokenizer(input, nesting);
+      tokens(tokenizer);
+      CAPTURE(input);
+      REQUIRE(tokenizer.error() == expected);
+    }
+  }
+
+  SECTION("input = std::istream") {
+    std::istringstream json("[1,2]");
+    auto tokenizer = makeJsonTokenizer(json);
+
+    REQUIRE(tokens(tokenizer) == "[nn]");
+  }
+
+  SECTION("input = std::string") {
+    std::string json("[1,2]");
+    auto tokenizer = makeJsonTokenizer(json);
+
+    REQUIRE(tokens(tokenizer) == "[nn]");
+  }
+
+  SECTION("input = char*, size_t") {
+    char json[] = "[1,2]garbage";
+    auto tokenizer = makeJsonTokenizer(json, 5);
+
+    REQUIRE(tokens(tokenizer) == "[nn]");
+  }
+
+  SECTION("input = char*, size_t, incomplete") {
+    auto tokenizer = makeJsonTokenizer("[1,2]", 4);
+
+    REQUIRE(tokens(tokenizer) == "[nn!");
+    REQUIRE(tokenizer.error() == DeserializationError::IncompleteInput);
+  }
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("JsonTokenizer benchmark", "[.benchmark]") {
+  // a list of DX cluster spots
+  std::string json = "[";
+  for (int i = 0; i < 200; i++) {
+    if (i)
+      json += ",";
+    json +=
+        "{\"spotter\":\"HB9ABC\",\"dx\":\"JA1XYZ\",\"frequency\":14074.5,"
+        "\"mode\":\"FT8\",\"comment\":\"CQ DX\",\"time\":1718960000}";
+  }
+  json += "]";
+  const int rounds = 1000;
+  using microseconds = std::chrono::duration<double, std::micro>;
+
+  double sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    JsonDocument doc;
+    deserializeJson(doc, json);
+    for (JsonObject spot : doc.as<JsonArray>())
+      sum += spot["frequency"].as<double>();
+  }
+  auto documentTime = microseconds(std::chrono::steady_clock::now() - start);
+  REQUIRE(sum == 14074.5 * 200 * rounds);
+
+  sum = 0;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    auto tokenizer = makeJsonTokenizer(json.c_str());
+    for (auto token = tokenizer.next();
+         token != JsonToken::End && token != JsonToken::Error;
+         token = tokenizer.next()) {
+      if (token == JsonToken::Key &&
+          strcmp(tokenizer.string(), "frequency") == 0) {
+        tokenizer.next();
+        sum += tokenizer.as<double>();
+      }
+    }
+  }
+  auto tokenizerTime = microseconds(std::chrono::steady_clock::now() - start);
+  REQUIRE(sum == 14074.5 * 200 * rounds);
+
+  double megabytes = double(json.size()) * rounds / 1e6;
+  WARN("deserializeJson(): " << megabytes / (documentTime.count() / 1e6)
+                             << " MB/s");
+  WARN("JsonTokenizer: " << megabytes / (tokenizerTime.count() / 1e6)
+                         << " MB/s");
+}
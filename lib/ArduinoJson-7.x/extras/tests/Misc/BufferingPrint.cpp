@@ -0,0 +1,358 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <Arduino.h>
+
+// StringWriter.cpp uses a different ARDUINOJSON_STRING_BUFFER_SIZE
+#define ARDUINOJSON_VERSION_NAMESPACE BufferingPrintTest
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+// Counts the bytes on the heap, to measure the peak usage of a piece of code.
+// This replaces the global operator new of the whole test executable.
+static size_t heapSize = 0;
+static size_t heapPeak = 0;
+static const size_t heapHeaderSize = sizeof(std::max_align_t);
+
+void* operator new(size_t size) {
+  auto block = static_cast<char*>(malloc(heapHeaderSize + size));
+  if (!block)
+    throw std::bad_alloc();
+  memcpy(block, &size, sizeof(size));
+  heapSize += size;
+  if (heapSize > heapPeak)
+    heapPeak = heapSize;
+  return block + heapHeaderSize;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (!ptr)
+    return;
+  auto block = static_cast<char*>(ptr) - heapHeaderSize;
+  size_t size;
+  memcpy(&size, block, sizeof(size));
+  heapSize -= size;
+  free(block);
+}
+
+template <typename TFunction>
+static size_t measureHeapPeak(TFunction function) {
+  size_t initialSize = heapSize;
+  heapPeak = heapSize;
+  function();
+  return heapPeak - initialSize;
+}
+
+// Records the blocks it receives, or refuses them when full
+class SpyingPrint : public Print {
+ public:
+  using Print::write;
+
+  size_t write(uint8_t c) override {
+    return write(&c, 1);
+  }
+
+  size_t write(const uint8_t* s, size_t n) override {
+    if (output.size() + n > capacity)
+      return 0;
+    output.append(reinterpret_cast<const char*>(s), n);
+    blocks.push_back(n);
+    return n;
+  }
+
+  void flush() override {
+    flushes++;
+  }
+
+  std::string output;
+  std::vector<size_t> blocks;
+  size_t capacity = 1024;
+  int flushes = 0;
+};
+
+// Discards what it receives, like a network client, without allocating
+class NullPrint : public Print {
+ public:
+  using Print::write;
+
+  size_t write(uint8_t) override {
+    bytes++;
+    writes++;
+    return 1;
+  }
+
+  size_t write(const uint8_t*, size_t n) override {
+    bytes += n;
+    writes++;
+    return n;
+  }
+
+  size_t bytes = 0;
+  size_t writes = 0;
+};
+
+// OneCharPrint hides ByteByBytePrint::write(const uint8_t*, size_t)
+#ifdef __GNUC__
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Woverloaded-virtual"
+#endif
+
+// Writes the blocks one byte at a time, like Arduino's Print
+class ByteByBytePrint : public Print {
+ public:
+  using Print::write;
+
+  size_t write(const uint8_t* s, size_t n) override {
+    size_t written = 0;
+    while (written < n && write(s[written]))
+      written++;
+    return written;
+  }
+};
+
+// Overrides only write(uint8_t), which hides write(const uint8_t*, size_t),
+// like many user-defined Print classes do
+class OneCharPrint : public ByteByBytePrint {
+ public:
+  size_t write(uint8_t c) override {
+    output += static_cast<char>(c);
+    return 1;
+  }
+
+  std::string output;
+};
+#ifdef __GNUC__
+#  pragma GCC diagnostic pop
+#endif
+
+using Blocks = std::vector<size_t>;
+
+TEST_CASE("BufferingPrint") {
+  SpyingPrint target;
+
+  SECTION("write(uint8_t)") {
+    BufferingPrint<4> print(target);
+
+    SECTION("accumulates in the buffer") {
+      REQUIRE(print.write('a') == 1);
+      REQUIRE(print.write('b') == 1);
+      REQUIRE(print.write('c') == 1);
+      REQUIRE(print.write('d') == 1);
+      REQUIRE(target.output == "");
+
+      // forwards when full
+      REQUIRE(print.write('e') == 1);
+      REQUIRE(target.output == "abcd");
+      REQUIRE(target.blocks == Blocks{4});
+
+      // forwards the rest on destruction
+      print.~BufferingPrint();
+      REQUIRE(target.output == "abcde");
+      REQUIRE(target.blocks == Blocks{4, 1});
+    }
+
+    SECTION("returns 0 when the target refuses the bytes") {
+      target.capacity = 3;
+      print.write('a');
+      print.write('b');
+      print.write('c');
+      print.write('d');
+
+      REQUIRE(print.write('e') == 0);
+      REQUIRE(target.output == "");
+    }
+  }
+
+  SECTION("write(const uint8_t*, size_t)") {
+    BufferingPrint<4> print(target);
+
+    SECTION("accumulates in the buffer") {
+      REQUIRE(print.write("ab") == 2);
+      REQUIRE(print.write("c") == 1);
+      REQUIRE(target.output == "");
+
+      // fills the buffer, and forwards it when more bytes come
+      REQUIRE(print.write("de") == 2);
+      REQUIRE(target.output == "abcd");
+
+      print.flush();
+      REQUIRE(target.output == "abcde");
+      REQUIRE(target.blocks == Blocks{4, 1});
+    }
+
+    SECTION("splits large blocks") {
+      REQUIRE(print.write("abcdefghij") == 10);
+      REQUIRE(target.output == "abcdefgh");
+
+      print.flush();
+      REQUIRE(target.blocks == Blocks{4, 4, 2});
+    }
+
+    SECTION("empty string") {
+      REQUIRE(print.write("") == 0);
+      print.flush();
+      REQUIRE(target.blocks == Blocks{});
+    }
+
+    SECTION("returns the number of bytes accepted") {
+      target.capacity = 2;
+
+      REQUIRE(print.write("abcd") == 4);
+      REQUIRE(print.write("ef") == 0);
+    }
+  }
+
+  SECTION("flush() without bytes doesn't write") {
+    BufferingPrint<4> print(target);
+    print.flush();
+    REQUIRE(target.blocks == Blocks{});
+  }
+
+  SECTION("flush() flushes the target after forwarding the bytes") {
+    BufferingPrint<4> print(target);
+    print.write("ab");
+    print.flush();
+    REQUIRE(target.output == "ab");
+    REQUIRE(target.flushes == 1);
+  }
+}
+
+// The document that the /config handler sends
+static void fillConfig(JsonDocument& doc) {
+  doc["latitude"] = 46.4667118;
+  doc["longitude"] = 6.8590456;
+  doc["localTimeColour"] = 2016;
+  doc["utcTimeColour"] = 65184;
+  doc["doubleFrame"] = false;
+  doc["localFrameColour"] = 31727;
+  doc["utcFrameColour"] = 31727;
+  doc["bannerColour"] = 992;
+  doc["bannerSpeed"] = 5;
+  doc["localTimeLabel"] = "  QTH Time  ";
+  doc["utcTimeLabel"] = "  UTC Time  ";
+  doc["startupLogo"] = "logo1.png";
+  doc["italicClockFonts"] = false;
+}
+
+TEST_CASE("serializeJson(doc, BufferingPrint)") {
+  JsonDocument doc;
+  fillConfig(doc);
+  std::string expected;
+  serializeJson(doc, expected);
+
+  SECTION("sends the document in blocks of N bytes") {
+    SpyingPrint target;
+    {
+      BufferingPrint<64> print(target);
+      REQUIRE(serializeJson(doc, print) == expected.size());
+    }
+
+    REQUIRE(target.output == expected);
+    REQUIRE(target.blocks.size() == (expected.size() + 63) / 64);
+    for (size_t i = 0; i + 1 < target.blocks.size(); i++)
+      REQUIRE(target.blocks[i] == 64);
+  }
+
+  SECTION("a Print alone receives one write per token") {
+    NullPrint target;
+    serializeJson(doc, target);
+    REQUIRE(target.writes > 50);
+  }
+
+  SECTION("a Print that only overrides write(uint8_t)") {
+    OneCharPrint target;
+    REQUIRE(serializeJson(doc, target) == expected.size());
+    REQUIRE(target.output == expected);
+  }
+}
+
+TEST_CASE("Heap peak of the /config response") {
+  static char arenaBuffer[8192];
+  ArenaAllocator arena(arenaBuffer, sizeof(arenaBuffer), nullptr);
+  ArenaScope scope(arena);
+  JsonDocument doc(&arena);
+  fillConfig(doc);
+  size_t length = measureJson(doc);
+
+  SECTION("serializeJson() to a String") {
+    size_t peak = measureHeapPeak([&]() {
+      ::String response;
+      serializeJson(doc, response);
+    });
+    CHECK(peak > length);
+  }
+
+  SECTION("serializeJson() to a BufferingPrint") {
+    NullPrint client;
+    size_t peak = measureHeapPeak([&]() {
+      BufferingPrint<128> print(client);
+      serializeJson(doc, print);
+    });
+    CHECK(peak == 0);
+    CHECK(client.bytes == length);
+    CHECK(client.writes == (length + 127) / 128);
+  }
+
+  SECTION("serializeMsgPack() to a BufferingPrint") {
+    NullPrint client;
+    size_t peak = measureHeapPeak([&]() {
+      BufferingPrint<128> print(client);
+      serializeMsgPack(doc, print);
+    });
+    CHECK(peak == 0);
+    CHECK(client.bytes == measureMsgPack(doc));
+  }
+
+  // the document itself never touched the heap
+  CHECK(arena.overflows() == 0);
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("/config response benchmark", "[.benchmark]") {
+  JsonDocument doc;
+  fillConfig(doc);
+  const int rounds = 100000;
+  using nanoseconds = std::chrono::duration<double, std::nano>;
+  NullPrint client;
+
+  // what the handler did: build a String, then copy it to the client
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    ::String response;
+    serializeJson(doc, response);
+    client.write(response.c_str(), response.length());
+  }
+  auto stringTime = nanoseconds(std::chrono::steady_clock::now() - start);
+
+  // reserve once with measureJson()
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    std::string response;
+    response.reserve(measureJson(doc));
+    serializeJson(doc, response);
+    client.write(response.c_str(), response.size());
+  }
+  auto reserveTime = nanoseconds(std::chrono::steady_clock::now() - start);
+
+  // stream to the client
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    BufferingPrint<128> print(client);
+    serializeJson(doc, print);
+  }
+  auto streamTime = nanoseconds(std::chrono::steady_clock::now() - start);
+
+  WARN("String: " << stringTime.count() / rounds << " ns");
+  WARN("measureJson() + reserve(): " << reserveTime.count() / rounds << " ns");
+  WARN("BufferingPrint: " << streamTime.count() / rounds << " ns");
+  WARN("(" << client.bytes << " bytes)");
+}
@@ -0,0 +1,14 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+// Runs the fast scan tests without SSE2 and NEON, on the word-at-a-time path
+// that the ESP32 uses
+#define ARDUINOJSON_FAST_SCAN_SSE2 0
+#define ARDUINOJSON_FAST_SCAN_NEON 0
+
+#include "../JsonDeserializer/fast_scan.cpp"
+
+#if ARDUINOJSON_FAST_SCAN_SSE2 || ARDUINOJSON_FAST_SCAN_NEON
+#  error The SIMD paths should be disabled
+#endif
@@ -0,0 +1,54 @@
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 0
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+
+TEST_CASE("ARDUINOJSON_OBJECT_INDEX_THRESHOLD == 0") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("large object isn't indexed") {
+    for (int i = 0; i < 100; i++)
+      doc[std::to_string(i)] = i;
+    spy.clearLog();
+
+    REQUIRE(doc["99"] == 99);
+    REQUIRE(doc["x"].isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+}
+
+// Run with "[.benchmark]", and compare with object_index_threshold_4.cpp
+static void benchmarkLookups(size_t members) {
+  JsonDocument doc;
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < members; i++) {
+    keys.push_back("member" + std::to_string(i));
+    doc[keys.back()] = i;
+  }
+  const JsonDocument& cdoc = doc;
+
+  const size_t lookups = 1 << 20;
+  size_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < lookups; i++)
+    sum += cdoc[keys[i % members].c_str()].as<size_t>();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  REQUIRE(sum == lookups / members * members * (members - 1) / 2);
+  using nanoseconds = std::chrono::duration<double, std::nano>;
+  auto ns = nanoseconds(elapsed).count() / double(lookups);
+  WARN(members << " members: " << ns << " ns/lookup");
+}
+
+TEST_CASE("ARDUINOJSON_OBJECT_INDEX_THRESHOLD == 0 benchmark",
+          "[.benchmark]") {
+  benchmarkLookups(8);
+  benchmarkLookups(32);
+  benchmarkLookups(128);
+}
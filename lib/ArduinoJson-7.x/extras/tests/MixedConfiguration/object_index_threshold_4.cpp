@@ -0,0 +1,204 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ObjectIndex
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 4
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Allocators.hpp"
+#include "Literals.hpp"
+
+using ArduinoJson::detail::sizeofObjectIndex;
+
+TEST_CASE("ARDUINOJSON_OBJECT_INDEX_THRESHOLD == 4") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("small object isn't indexed") {
+    doc["a"] = 1;
+    doc["b"] = 2;
+    doc["c"] = 3;
+    spy.clearLog();
+
+    REQUIRE(doc["c"] == 3);
+    REQUIRE(doc["x"].isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("finds keys before the threshold without an index") {
+    doc["a"] = 1;
+    doc["b"] = 2;
+    doc["c"] = 3;
+    doc["d"] = 4;
+    spy.clearLog();
+
+    REQUIRE(doc["d"] == 4);
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("lookup beyond the threshold builds the index once") {
+    doc["a"] = 1;
+    doc["b"] = 2;
+    doc["c"] = 3;
+    doc["d"] = 4;
+    spy.clearLog();
+
+    REQUIRE(doc["e"].isNull());
+    REQUIRE(doc["a"] == 1);
+    REQUIRE(doc["d"] == 4);
+    REQUIRE(doc["f"].isNull());
+    REQUIRE(spy.log() == AllocatorLog{
+                             Allocate(sizeofObjectIndex(16)),
+                         });
+  }
+
+  SECTION("finds every key of a large object") {
+    for (int i = 0; i < 100; i++)
+      doc[std::to_string(i)] = i;
+
+    for (int i = 0; i < 100; i++)
+      REQUIRE(doc[std::to_string(i)] == i);
+    REQUIRE(doc["100"].isNull());
+    REQUIRE(doc.size() == 100);
+  }
+
+  SECTION("indexes the keys added afterward") {
+    doc["a"] = 1;
+    doc["b"] = 2;
+    doc["c"] = 3;
+    doc["d"] = 4;
+    REQUIRE(doc["x"].isNull());  // builds the index
+    doc["e"] = 5;
+    doc["f"] = 6;
+    doc["g"] = 7;
+    doc["h"] = 8;
+    doc["i"] = 9;
+    spy.clearLog();
+
+    REQUIRE(doc["i"] == 9);  // load factor > 1/2 => rebuild
+    REQUIRE(doc["e"] == 5);
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofObjectIndex(16)),
+                             Allocate(sizeofObjectIndex(64)),
+                         });
+  }
+
+  SECTION("setting an existing key doesn't add a member") {
+    for (int i = 0; i < 10; i++)
+      doc[std::to_string(i)] = i;
+
+    doc["7"] = 42;
+
+    REQUIRE(doc["7"] == 42);
+    REQUIRE(doc.size() == 10);
+  }
+
+  SECTION("remove() drops the index") {
+    for (int i = 0; i < 10; i++)
+      doc[std::to_string(i)] = i;
+    REQUIRE(doc["x"].isNull());  // builds the index
+    spy.clearLog();
+
+    doc.remove("5");
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofObjectIndex(64)),
+                         });
+    REQUIRE(doc["5"].isNull());
+    REQUIRE(doc["6"] == 6);
+    REQUIRE(doc["9"] == 9);
+    REQUIRE(doc.size() == 9);
+  }
+
+  SECTION("clear() releases the index") {
+    for (int i = 0; i < 10; i++)
+      doc[std::to_string(i)] = i;
+    REQUIRE(doc["x"].isNull());  // builds the index
+
+    doc.clear();
+
+    REQUIRE(spy.allocatedBytes() == 0);
+    REQUIRE(doc["1"].isNull());
+  }
+
+  SECTION("replacing a nested object releases its index") {
+    JsonObject obj = doc["obj"].to<JsonObject>();
+    for (int i = 0; i < 10; i++)
+      obj[std::to_string(i)] = i;
+    REQUIRE(obj["x"].isNull());  // builds the index
+    spy.clearLog();
+
+    doc["obj"] = 42;
+
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofObjectIndex(64)),
+                         });
+  }
+
+  SECTION("index survives a move") {
+    for (int i = 0; i < 10; i++)
+      doc[std::to_string(i)] = i;
+    REQUIRE(doc["x"].isNull());  // builds the index
+
+    JsonDocument doc2(std::move(doc));
+    doc2["10"] = 10;
+
+    REQUIRE(doc2["3"] == 3);
+    REQUIRE(doc2["10"] == 10);
+    REQUIRE(doc2.size() == 11);
+  }
+
+  SECTION("deserializeJson() indexes large objects") {
+    auto err = deserializeJson(
+        doc, "{\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6,\"a\":7}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() ==
+            "{\"a\":7,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6}");
+    REQUIRE(doc["f"] == 6);
+  }
+
+  SECTION("falls back to a linear search if the index can't be allocated") {
+    KillswitchAllocator killswitch;
+    JsonDocument doc2(&killswitch);
+    for (int i = 0; i < 10; i++)
+      doc2[std::to_string(i)] = i;
+    killswitch.on();
+
+    REQUIRE(doc2["9"] == 9);
+    REQUIRE(doc2["x"].isNull());
+    REQUIRE(doc2.overflowed() == false);
+  }
+}
+
+// Run with "[.benchmark]", and compare with object_index_threshold_0.cpp
+static void benchmarkLookups(size_t members) {
+  JsonDocument doc;
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < members; i++) {
+    keys.push_back("member" + std::to_string(i));
+    doc[keys.back()] = i;
+  }
+  const JsonDocument& cdoc = doc;
+
+  const size_t lookups = 1 << 20;
+  size_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < lookups; i++)
+    sum += cdoc[keys[i % members].c_str()].as<size_t>();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  REQUIRE(sum == lookups / members * members * (members - 1) / 2);
+  using nanoseconds = std::chrono::duration<double, std::nano>;
+  auto ns = nanoseconds(elapsed).count() / double(lookups);
+  WARN(members << " members: " << ns << " ns/lookup");
+}
+
+TEST_CASE("ARDUINOJSON_OBJECT_INDEX_THRESHOLD == 4 benchmark",
+          "[.benchmark]") {
+  benchmarkLookups(8);
+  benchmarkLookups(32);
+  benchmarkLookups(128);
+}
@@ -0,0 +1,172 @@
+#define ARDUINOJSON_VERSION_NAMESPACE ShortestFloat
+#define ARDUINOJSON_SHORTEST_FLOAT 1
+#define ARDUINOJSON_ENABLE_NAN 1
+#define ARDUINOJSON_ENABLE_INFINITY 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+using ArduinoJson::detail::decimalToFloat;
+using ArduinoJson::detail::decomposeFloat;
+using ArduinoJson::detail::make_float;
+using ArduinoJson::detail::parseNumber;
+using ArduinoJson::detail::shortestDecimal;
+
+template <typename T>
+static std::string toJson(T value) {
+  JsonDocument doc;
+  doc.set(value);
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
+
+// Checks that the value is the same, bit for bit, after a round-trip
+template <typename T>
+static bool roundTrips(T value) {
+  std::string json = toJson(value);
+  T result = parseNumber<T>(json.c_str());
+  return memcmp(&result, &value, sizeof(T)) == 0;
+}
+
+TEST_CASE("ARDUINOJSON_SHORTEST_FLOAT == 1") {
+  SECTION("double") {
+    CHECK(toJson(0.1) == "0.1");
+    CHECK(toJson(0.30000000000000004) == "0.30000000000000004");
+    CHECK(toJson(3.141592653589793) == "3.141592653589793");
+    CHECK(toJson(-2.5) == "-2.5");
+    CHECK(toJson(1.0) == "1");
+    CHECK(toJson(1234567.0) == "1234567");
+    CHECK(toJson(0.0001) == "0.0001");
+    CHECK(toJson(0.0) == "0");
+    CHECK(toJson(-0.0) == "0");
+  }
+
+  SECTION("float") {
+    CHECK(toJson(0.1f) == "0.1");
+    CHECK(toJson(3.1415927f) == "3.1415927");
+    CHECK(toJson(16777216.0f) == "1.6777216e7");
+    CHECK(toJson(21.5f) == "21.5");
+  }
+
+  SECTION("exponentiation when >= 1e7 or <= 1e-5") {
+    CHECK(toJson(9999999.999) == "9999999.999");
+    CHECK(toJson(1e7) == "1e7");
+    CHECK(toJson(1.5e-5) == "0.000015");
+    CHECK(toJson(1e-5) == "1e-5");
+    CHECK(toJson(1.7976931348623157e308) == "1.7976931348623157e308");
+    CHECK(toJson(2.2250738585072014e-308) == "2.2250738585072014e-308");
+    CHECK(toJson(5e-324) == "5e-324");
+    CHECK(toJson(-1e-300) == "-1e-300");
+  }
+
+  SECTION("special values") {
+    CHECK(toJson(std::numeric_limits<double>::quiet_NaN()) == "NaN");
+    CHECK(toJson(std::numeric_limits<double>::infinity()) == "Infinity");
+    CHECK(toJson(-std::numeric_limits<float>::infinity()) == "-Infinity");
+  }
+
+  SECTION("round-trips a sample of the floats") {
+    uint32_t failures = 0;
+    // a prime step visits every exponent and many mantissas
+    for (uint64_t bits = 1; bits < 0x7F800000; bits += 2039) {
+      float value;
+      uint32_t bits32 = uint32_t(bits);
+      memcpy(&value, &bits32, sizeof(value));
+      if (!roundTrips(value) && failures++ < 10)
+        FAIL_CHECK(toJson(value) << " doesn't round-trip");
+    }
+    REQUIRE(failures == 0);
+  }
+
+  SECTION("round-trips random doubles") {
+    std::mt19937_64 random(42);
+    uint32_t failures = 0;
+    for (int i = 0; i < 1000000; i++) {
+      uint64_t bits = random() & 0x7FFFFFFFFFFFFFFF;
+      if (i % 8 == 0)
+        bits &= 0x000FFFFFFFFFFFFF;  // subnormal
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+      if (value != value || value * 2 == value)
+        continue;  // NaN or Infinity (or zero)
+      if (!roundTrips(value) && failures++ < 10)
+        FAIL_CHECK(toJson(value) << " doesn't round-trip");
+    }
+    REQUIRE(failures == 0);
+  }
+}
+
+// Run with "[.exhaustive]", takes a few minutes
+TEST_CASE("every float round-trips", "[.exhaustive]") {
+  uint32_t failures = 0;
+  for (uint32_t bits = 1; bits < 0x7F800000; bits++) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    auto decimal = shortestDecimal(value);
+    char json[32];
+    memcpy(json, decimal.digits, decimal.length);
+    snprintf(json + decimal.length, sizeof(json) - decimal.length, "e%d",
+             decimal.exponent);
+    float result = parseNumber<float>(json);
+    if (result != value && failures++ < 10)
+      FAIL_CHECK(json << " doesn't round-trip");
+  }
+  REQUIRE(failures == 0);
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("float conversion benchmark", "[.benchmark]") {
+  std::mt19937_64 random(42);
+  const int count = 1000000;
+  std::vector<double> values;
+  std::vector<uint64_t> mantissas;
+  std::vector<int> exponents;
+  for (int i = 0; i < count; i++) {
+    values.push_back(double(random() % 100000000 + 1) / 1000);
+    mantissas.push_back(random() % 10000000000000000);
+    exponents.push_back(int(random() % 40) - 20);
+  }
+  using milliseconds = std::chrono::duration<double, std::milli>;
+  double sum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    sum += make_float(double(mantissas[size_t(i)] / 10), exponents[size_t(i)]);
+  auto makeFloatTime = milliseconds(std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    double value = 0;
+    decimalToFloat(mantissas[size_t(i)], exponents[size_t(i)], value);
+    sum += value;
+  }
+  auto decimalToFloatTime =
+      milliseconds(std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    sum += decomposeFloat(values[size_t(i)], 9).decimal;
+  auto decomposeFloatTime =
+      milliseconds(std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++)
+    sum += shortestDecimal(values[size_t(i)]).length;
+  auto shortestDecimalTime =
+      milliseconds(std::chrono::steady_clock::now() - start);
+
+  WARN("make_float(): " << makeFloatTime.count() << " ms");
+  WARN("decimalToFloat(): " << decimalToFloatTime.count() << " ms");
+  WARN("decomposeFloat(): " << decomposeFloatTime.count() << " ms");
+  WARN("shortestDecimal(): " << shortestDecimalTime.count() << " ms");
+  WARN("(checksum: " << sum << ")");
+}
@@ -0,0 +1,143 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <chrono>
+#include <string>
+
+// What a web client exchanges with a device: a configuration to display, and
+// the small commands sent while the user drags a colour picker
+static const char* configJson =
+    "{\"latitude\":46.4667118,\"longitude\":6.8590456,"
+    "\"localTimeColour\":2016,\"utcTimeColour\":65184,\"doubleFrame\":false,"
+    "\"localFrameColour\":31727,\"utcFrameColour\":31727,"
+    "\"bannerColour\":992,\"bannerSpeed\":5,"
+    "\"localTimeLabel\":\"  QTH Time  \",\"utcTimeLabel\":\"  UTC Time  \","
+    "\"startupLogo\":\"logo1.png\",\"italicClockFonts\":false}";
+static const char* colorJson = "{\"target\":\"localTimeDigits\",\"color\":63488}";
+
+// Converts the JSON document to MessagePack and back
+static std::string roundTrip(const std::string& json) {
+  JsonDocument original, copy;
+  REQUIRE(deserializeJson(original, json) == DeserializationError::Ok);
+
+  std::string msgpack;
+  size_t n = serializeMsgPack(original, msgpack);
+  REQUIRE(n == msgpack.size());
+  REQUIRE(n == measureMsgPack(original));
+  REQUIRE(deserializeMsgPack(copy, msgpack) == DeserializationError::Ok);
+
+  CHECK(copy == original);
+  std::string result;
+  serializeJson(copy, result);
+  return result;
+}
+
+TEST_CASE("JSON -> MessagePack -> JSON") {
+  SECTION("payloads of the web API") {
+    CHECK(roundTrip(configJson) == configJson);
+    CHECK(roundTrip(colorJson) == colorJson);
+  }
+
+  SECTION("every type") {
+    const char* inputs[] = {
+        "null",
+        "true",
+        "[false,true,null]",
+        "[0,1,127,128,255,256,65535,65536,4294967295,4294967296]",
+        "[-1,-32,-33,-128,-129,-32768,-32769,-2147483648,-2147483649]",
+        "[9223372036854775807,-9223372036854775808,18446744073709551615]",
+        "[0.5,-2.25,46.4667118,3.4e38,1e-300]",
+        "[\"\",\"a\",\"caf\xc3\xa9\",\"\\u0000nul\\u0000\"]",
+        "[[],{},[[[]]],{\"a\":{\"b\":{\"c\":[1]}}}]",
+    };
+    for (const char* input : inputs) {
+      CAPTURE(input);
+      CHECK(roundTrip(input) == input);
+    }
+  }
+
+  SECTION("strings of every length prefix") {
+    // fixstr, str8, str16
+    size_t lengths[] = {0, 31, 32, 255, 256, 65535};
+    for (size_t length : lengths) {
+      CAPTURE(length);
+      std::string json = "[\"" + std::string(length, 'x') + "\"]";
+      CHECK(roundTrip(json) == json);
+    }
+  }
+
+  SECTION("arrays and objects of every size prefix") {
+    // fixarray, array16, array32
+    size_t sizes[] = {15, 16, 65535, 65536};
+    for (size_t size : sizes) {
+      CAPTURE(size);
+      std::string json = "[1";
+      for (size_t i = 1; i < size; i++)
+        json += ",1";
+      json += "]";
+      CHECK(roundTrip(json) == json);
+    }
+
+    // fixmap, map16
+    CHECK(roundTrip("{\"0\":0,\"1\":1,\"2\":2,\"3\":3,\"4\":4,\"5\":5,"
+                    "\"6\":6,\"7\":7,\"8\":8,\"9\":9,\"a\":10,\"b\":11,"
+                    "\"c\":12,\"d\":13,\"e\":14,\"f\":15}") ==
+          "{\"0\":0,\"1\":1,\"2\":2,\"3\":3,\"4\":4,\"5\":5,\"6\":6,"
+          "\"7\":7,\"8\":8,\"9\":9,\"a\":10,\"b\":11,\"c\":12,\"d\":13,"
+          "\"e\":14,\"f\":15}");
+  }
+
+  SECTION("MessagePack is smaller") {
+    JsonDocument doc;
+    deserializeJson(doc, configJson);
+    CHECK(measureMsgPack(doc) < measureJson(doc));
+    deserializeJson(doc, colorJson);
+    CHECK(measureMsgPack(doc) < measureJson(doc));
+  }
+}
+
+// Run with "[.benchmark]"
+TEST_CASE("JSON vs MessagePack benchmark", "[.benchmark]") {
+  const char* payloads[] = {configJson, colorJson};
+  const int rounds = 100000;
+  using nanoseconds = std::chrono::duration<double, std::nano>;
+
+  for (const char* payload : payloads) {
+    JsonDocument doc;
+    deserializeJson(doc, payload);
+    std::string json, msgpack;
+    serializeJson(doc, json);
+    serializeMsgPack(doc, msgpack);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+      serializeJson(doc, json);
+    auto jsonWrite = nanoseconds(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+      serializeMsgPack(doc, msgpack);
+    auto msgpackWrite = nanoseconds(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+      deserializeJson(doc, json);
+    auto jsonRead = nanoseconds(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+      deserializeMsgPack(doc, msgpack);
+    auto msgpackRead = nanoseconds(std::chrono::steady_clock::now() - start);
+
+    WARN(json.size() << " bytes of JSON, " << msgpack.size()
+                     << " bytes of MessagePack");
+    WARN("write: JSON " << jsonWrite.count() / rounds << " ns, MessagePack "
+                        << msgpackWrite.count() / rounds << " ns");
+    WARN("read: JSON " << jsonRead.count() / rounds << " ns, MessagePack "
+                       << msgpackRead.count() / rounds << " ns");
+  }
+}
@@ -16,6 +16,11 @@ void checkDouble(const char* input, double expected) {
   REQUIRE(parseNumber<double>(input) == Approx(expected));
 }
 
+void checkDoubleExact(const char* input, double expected) {
+  CAPTURE(input);
+  REQUIRE(parseNumber<double>(input) == expected);
+}
+
 void checkDoubleNaN(const char* input) {
   CAPTURE(input);
   double result = parseNumber<double>(input);
@@ -82,6 +87,29 @@ TEST_CASE("parseNumber<double>()") {
     checkDouble("-1797693.134862315711111111111111", -1797693.1348623157);
   }
 
+  SECTION("Nearest") {
+    checkDoubleExact("0.1000000000000000055511151231257827", 0.1);
+    checkDoubleExact("0.30000000000000004", 0.30000000000000004);
+    checkDoubleExact("3.141592653589793", 3.141592653589793);
+    checkDoubleExact("1.0000000000000000e23", 1e23);
+    checkDoubleExact("8.98846567431158e307", 8.98846567431158e307);
+    checkDoubleExact("1.7976931348623157e308", 1.7976931348623157e308);
+    checkDoubleExact("123456789012345678901234567890", 1.2345678901234568e29);
+  }
+
+  SECTION("Halfway") {
+    checkDoubleExact("9007199254740993.0", 9007199254740992.0);
+    checkDoubleExact("9007199254740995.0", 9007199254740996.0);
+  }
+
+  SECTION("Subnormal") {
+    checkDoubleExact("2.2250738585072011e-308", 2.2250738585072011e-308);
+    checkDoubleExact("1e-310", 1e-310);
+    checkDoubleExact("4.9406564584124654e-324", 4.9406564584124654e-324);
+    checkDoubleExact("2.4703282292062328e-324", 4.9406564584124654e-324);
+    checkDoubleExact("2.4703282292062327e-324", 0.0);
+  }
+
   SECTION("ExponentTooBig") {
     checkDoubleInf("1e309", false);
     checkDoubleInf("-1e309", true);
@@ -17,6 +17,13 @@ void checkFloat(const char* input, float expected) {
   REQUIRE(result.asFloat() == Approx(expected));
 }
 
+void checkFloatExact(const char* input, float expected) {
+  CAPTURE(input);
+  auto result = parseNumber(input);
+  REQUIRE(result.type() == NumberType::Float);
+  REQUIRE(result.asFloat() == expected);
+}
+
 void checkFloatNaN(const char* input) {
   CAPTURE(input);
   float result = parseNumber<float>(input);
@@ -71,6 +78,14 @@ TEST_CASE("parseNumber<float>()") {
     //     1e+32f);
   }
 
+  SECTION("Nearest") {
+    checkFloatExact("0.1", 0.1f);
+    checkFloatExact("0.3", 0.3f);
+    checkFloatExact("7.038531e-26", 7.038531e-26f);
+    checkFloatExact("1e-38", 1e-38f);
+    checkFloatExact("3.4e38", 3.4e38f);
+  }
+
   SECTION("NaN") {
     checkFloatNaN("NaN");
     checkFloatNaN("nan");
@@ -0,0 +1,267 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+TEST_CASE("ArenaAllocator") {
+  SpyingAllocator heap;
+  alignas(void*) char buffer[256];
+  ArenaAllocator arena(buffer, sizeof(buffer), &heap);
+
+  SECTION("allocates from the buffer") {
+    void* a = arena.allocate(10);
+    void* b = arena.allocate(20);
+
+    REQUIRE(a >= buffer);
+    REQUIRE(b > a);
+    REQUIRE(b < buffer + sizeof(buffer));
+    REQUIRE(arena.size() > 30);
+    REQUIRE(heap.log() == AllocatorLog{});
+  }
+
+  SECTION("aligns the blocks") {
+    void* a = arena.allocate(1);
+    void* b = arena.allocate(3);
+
+    REQUIRE(reinterpret_cast<size_t>(a) % sizeof(void*) == 0);
+    REQUIRE(reinterpret_cast<size_t>(b) % sizeof(void*) == 0);
+  }
+
+  SECTION("aligns an unaligned buffer") {
+    ArenaAllocator unaligned(buffer + 1, sizeof(buffer) - 1, &heap);
+
+    void* a = unaligned.allocate(1);
+
+    REQUIRE(reinterpret_cast<size_t>(a) % sizeof(void*) == 0);
+    REQUIRE(unaligned.capacity() == sizeof(buffer) - sizeof(void*));
+  }
+
+  SECTION("deallocate() releases the last block only") {
+    arena.allocate(10);
+    void* b = arena.allocate(20);
+    size_t size = arena.size();
+    void* c = arena.allocate(30);
+
+    arena.deallocate(b);
+    REQUIRE(arena.size() > size);
+
+    arena.deallocate(c);
+    REQUIRE(arena.size() == size);
+    REQUIRE(arena.allocate(20) == c);
+  }
+
+  SECTION("reallocate() grows the last block in place") {
+    auto p = static_cast<char*>(arena.allocate(10));
+    strcpy(p, "hello");
+
+    REQUIRE(arena.reallocate(p, 100) == p);
+    REQUIRE(std::string(p) == "hello");
+  }
+
+  SECTION("reallocate() shrinks any block in place") {
+    void* a = arena.allocate(100);
+    arena.allocate(10);
+    size_t size = arena.size();
+
+    REQUIRE(arena.reallocate(a, 50) == a);
+    REQUIRE(arena.size() == size);
+  }
+
+  SECTION("reallocate() moves the other blocks") {
+    auto a = static_cast<char*>(arena.allocate(10));
+    strcpy(a, "hello");
+    arena.allocate(10);
+
+    auto b = static_cast<char*>(arena.reallocate(a, 50));
+
+    REQUIRE(b > a);
+    REQUIRE(std::string(b) == "hello");
+  }
+
+  SECTION("reallocate(nullptr) allocates") {
+    REQUIRE(arena.reallocate(nullptr, 10) != nullptr);
+    REQUIRE(arena.size() > 0);
+  }
+
+  SECTION("overflows to the upstream allocator") {
+    arena.allocate(200);
+
+    void* p = arena.allocate(100);
+
+    REQUIRE(p != nullptr);
+    REQUIRE(arena.overflows() == 1);
+    REQUIRE(heap.log() == AllocatorLog{Allocate(100)});
+
+    p = arena.reallocate(p, 150);
+    arena.deallocate(p);
+
+    REQUIRE(heap.log() == AllocatorLog{
+                              Allocate(100),
+                              Reallocate(100, 150),
+                              Deallocate(150),
+                          });
+  }
+
+  SECTION("moves the last block upstream when it can't grow") {
+    auto p = static_cast<char*>(arena.allocate(100));
+    strcpy(p, "hello");
+
+    auto q = static_cast<char*>(arena.reallocate(p, 1000));
+
+    REQUIRE(std::string(q) == "hello");
+    REQUIRE(arena.size() == 0);
+    REQUIRE(heap.log() == AllocatorLog{Allocate(1000)});
+    arena.deallocate(q);
+  }
+
+  SECTION("fails when full without upstream allocator") {
+    ArenaAllocator bounded(buffer, sizeof(buffer), nullptr);
+
+    REQUIRE(bounded.allocate(1000) == nullptr);
+    REQUIRE(bounded.overflows() == 1);
+  }
+
+  SECTION("reset() releases everything") {
+    void* a = arena.allocate(10);
+    arena.allocate(20);
+
+    arena.reset();
+
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.allocate(10) == a);
+  }
+
+  SECTION("peak()") {
+    arena.allocate(100);
+    size_t peak = arena.size();
+    arena.reset();
+    arena.allocate(10);
+
+    REQUIRE(arena.peak() == peak);
+  }
+}
+
+TEST_CASE("ArenaScope") {
+  alignas(void*) char buffer[1024];
+  ArenaAllocator arena(buffer, sizeof(buffer), nullptr);
+
+  SECTION("rewinds the arena") {
+    arena.allocate(10);
+    size_t size = arena.size();
+
+    {
+      ArenaScope scope(arena);
+      arena.allocate(20);
+      arena.allocate(30);
+    }
+
+    REQUIRE(arena.size() == size);
+  }
+
+  SECTION("nested scopes") {
+    ArenaScope outer(arena);
+    arena.allocate(10);
+    size_t size = arena.size();
+
+    {
+      ArenaScope inner(arena);
+      arena.allocate(20);
+    }
+
+    REQUIRE(arena.size() == size);
+  }
+
+  SECTION("JsonDocument") {
+    {
+      ArenaScope scope(arena);
+      JsonDocument doc(&arena);
+
+      auto err = deserializeJson(doc, "{\"hello\":\"world\",\"answer\":42}");
+
+      REQUIRE(err == DeserializationError::Ok);
+      REQUIRE(doc["hello"] == "world");
+      REQUIRE(arena.size() > 0);
+    }
+
+    REQUIRE(arena.size() == 0);
+  }
+}
+
+// Simulates the requests of a web server: each one parses a body or builds a
+// response in a document bound to the arena, with sizes that vary from one
+// request to the other.
+TEST_CASE("ArenaAllocator soak test") {
+  SpyingAllocator heap;
+  static char buffer[4096];
+  ArenaAllocator arena(buffer, sizeof(buffer), &heap);
+  uint32_t seed = 42;
+  auto random = [&seed](uint32_t max) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % max;
+  };
+
+  const int requests = 30000;
+  size_t peakAfterWarmup = 0;
+
+  for (int i = 0; i < requests; i++) {
+    {
+      ArenaScope scope(arena);
+      JsonDocument doc(&arena);
+      std::string label(random(40), 'x');
+
+      switch (random(3)) {
+        case 0: {  // POST with a body
+          std::string body = "{\"latitude\":46.4667,\"longitude\":6.859,"
+                             "\"label\":\"" +
+                             label + "\"}";
+          REQUIRE(deserializeJson(doc, body) == DeserializationError::Ok);
+          REQUIRE(doc["label"].as<std::string>() == label);
+          break;
+        }
+
+        case 1: {  // GET with a JSON response
+          doc["latitude"] = 46.4667;
+          doc["label"] = label;
+          JsonArray traces = doc["traces"].to<JsonArray>();
+          for (uint32_t n = random(10); n > 0; n--)
+            traces.add(label + std::to_string(n));
+          std::string response;
+          serializeJson(doc, response);
+          REQUIRE(response.size() > 20);
+          break;
+        }
+
+        default: {  // the same document reused
+          for (int n = 0; n < 3; n++) {
+            doc.clear();
+            doc["bannerSpeed"] = n;
+            doc["startupLogo"] = label;
+          }
+          break;
+        }
+      }
+
+      REQUIRE(arena.size() > 0);
+    }
+
+    // no leftover, so no fragmentation
+    REQUIRE(arena.size() == 0);
+
+    if (i == requests / 10)
+      peakAfterWarmup = arena.peak();
+  }
+
+  // no heap traffic at all
+  REQUIRE(arena.overflows() == 0);
+  REQUIRE(heap.log() == AllocatorLog{});
+
+  // the high-water mark stops growing once every kind of request was seen
+  REQUIRE(arena.peak() == peakAfterWarmup);
+  REQUIRE(arena.peak() < arena.capacity());
+}
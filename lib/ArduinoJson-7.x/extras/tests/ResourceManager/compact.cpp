@@ -0,0 +1,159 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <random>
+#include <string>
+
+#include "Allocators.hpp"
+
+static std::string toJson(const JsonDocument& doc) {
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
+
+TEST_CASE("JsonDocument::compact()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("empty document") {
+    doc.compact();
+
+    REQUIRE(doc.isNull());
+    REQUIRE(spy.log() == AllocatorLog{});
+  }
+
+  SECTION("shrinks the pool when nothing was removed") {
+    doc.add(1);
+    doc.add(2);
+    spy.clearLog();
+
+    doc.compact();
+
+    REQUIRE(toJson(doc) == "[1,2]");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Reallocate(sizeofPool(), sizeofPool(2)),
+                         });
+  }
+
+  SECTION("moves the elements into the freed slots") {
+    for (int i = 0; i < 40; i++)
+      doc.add(i);
+    for (int i = 0; i < 30; i++)
+      doc.remove(0);
+    spy.clearLog();
+
+    doc.compact();
+
+    REQUIRE(toJson(doc) == "[30,31,32,33,34,35,36,37,38,39]");
+    REQUIRE(spy.log() == AllocatorLog{
+                             Deallocate(sizeofPool()),
+                             Deallocate(sizeofPool()),
+                             Reallocate(sizeofPool(), sizeofPool(10)),
+                         });
+  }
+
+  SECTION("nested objects and arrays") {
+    deserializeJson(doc,
+                    "{\"removed\":[1,2,3,4,5,6,7,8],\"a\":{\"b\":[1,{\"c\":2}],"
+                    "\"removed\":{\"x\":1,\"y\":2}},\"d\":[[],{}],\"e\":true}");
+    doc.remove("removed");
+    doc["a"].remove("removed");
+    size_t slotsUsed = doc.stats().slotsUsed;
+
+    doc.compact();
+
+    REQUIRE(toJson(doc) ==
+            "{\"a\":{\"b\":[1,{\"c\":2}]},\"d\":[[],{}],\"e\":true}");
+    REQUIRE(doc.stats().slotsAllocated == slotsUsed);
+    REQUIRE(doc.stats().slotsUsed == slotsUsed);
+  }
+
+  SECTION("64-bit values") {
+    deserializeJson(doc,
+                    "[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,"
+                    "{\"big\":12345678901234567890,\"pi\":3.141592654}]");
+    for (int i = 0; i < 16; i++)
+      doc.remove(0);
+
+    doc.compact();
+
+    REQUIRE(toJson(doc) ==
+            "[{\"big\":12345678901234567890,\"pi\":3.141592654}]");
+    REQUIRE(doc[0]["big"].as<uint64_t>() == 12345678901234567890U);
+    REQUIRE(doc.stats().slotsAllocated == doc.stats().slotsUsed);
+  }
+
+  SECTION("the document can grow again") {
+    for (int i = 0; i < 20; i++)
+      doc.add(i);
+    for (int i = 0; i < 18; i++)
+      doc.remove(0);
+    doc.compact();
+
+    doc.add(20);
+    doc.add(21);
+
+    REQUIRE(toJson(doc) == "[18,19,20,21]");
+  }
+
+  SECTION("removes every pool when the root is a scalar") {
+    doc.add(1);
+    doc.add(2);
+    doc.set(42);
+
+    doc.compact();
+
+    REQUIRE(toJson(doc) == "42");
+    REQUIRE(doc.stats().slotsAllocated == 0);
+    REQUIRE(spy.allocatedBytes() == 0);
+  }
+
+  SECTION("keeps the content after random removals") {
+    std::mt19937 random(42);
+    for (int round = 0; round < 20; round++) {
+      doc.clear();
+      for (int i = 0; i < 10; i++) {
+        JsonObject obj = doc[std::to_string(i)].to<JsonObject>();
+        obj["n"] = i;
+        obj["list"].add(i);
+        obj["list"].add(int64_t(i) << 40);
+      }
+      for (int i = 0; i < 8; i++) {
+        auto key = std::to_string(random() % 10);
+        if (random() % 2)
+          doc.remove(key);
+        else
+          doc[key]["list"].remove(0);
+      }
+      std::string expected = toJson(doc);
+      size_t slotsUsed = doc.stats().slotsUsed;
+
+      doc.compact();
+
+      REQUIRE(toJson(doc) == expected);
+      REQUIRE(doc.stats().slotsAllocated == slotsUsed);
+    }
+  }
+}
+
+TEST_CASE("JsonDocument::compact() after a failed allocation") {
+  TimebombAllocator timebomb(1);
+  JsonDocument doc(&timebomb);
+  for (int i = 0; i < ARDUINOJSON_POOL_CAPACITY; i++)
+    doc.add(i);
+  doc.add(16);  // the second pool fails
+  timebomb.setCountdown(1);
+  doc.add(17);  // the third one succeeds
+  doc.remove(0);
+  REQUIRE(doc.overflowed());
+  std::string expected = toJson(doc);
+
+  doc.compact();  // the slot ids have a gap, so nothing moves
+
+  REQUIRE(toJson(doc) == expected);
+}
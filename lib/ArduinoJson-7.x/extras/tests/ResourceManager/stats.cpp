@@ -0,0 +1,98 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "Allocators.hpp"
+
+using ArduinoJson::detail::sizeofString;
+
+TEST_CASE("JsonDocument::stats()") {
+  SpyingAllocator spy;
+  JsonDocument doc(&spy);
+
+  SECTION("empty document") {
+    auto stats = doc.stats();
+
+    REQUIRE(stats.slotsUsed == 0);
+    REQUIRE(stats.slotsAllocated == 0);
+    REQUIRE(stats.strings == 0);
+    REQUIRE(stats.stringsShared == 0);
+    REQUIRE(stats.bytesAllocated == 0);
+    REQUIRE(stats.bytesWasted == 0);
+    REQUIRE(stats.peak == 0);
+  }
+
+  SECTION("one pool") {
+    doc.add(1);
+    doc.add(2);
+    doc.add(3);
+
+    auto stats = doc.stats();
+
+    REQUIRE(stats.slotsUsed == 3);
+    REQUIRE(stats.slotsAllocated == ARDUINOJSON_POOL_CAPACITY);
+    REQUIRE(stats.bytesAllocated == sizeofPool());
+    REQUIRE(stats.bytesWasted == sizeofPool(ARDUINOJSON_POOL_CAPACITY - 3));
+    REQUIRE(stats.peak == sizeofPool());
+  }
+
+  SECTION("counts the strings and the shared references") {
+    deserializeJson(doc,
+                    "{\"alpha\":\"hello\",\"beta\":\"hello\","
+                    "\"gamma\":\"alpha\"}");
+
+    auto stats = doc.stats();
+
+    REQUIRE(stats.strings == 4);        // alpha, beta, gamma, hello
+    REQUIRE(stats.stringsShared == 2);  // alpha, hello
+    REQUIRE(stats.bytesAllocated ==
+            sizeofPool(6) + 3 * sizeofString(5) + sizeofString(4));
+    REQUIRE(stats.bytesAllocated == spy.allocatedBytes());
+  }
+
+  SECTION("removals waste slots") {
+    for (int i = 0; i < 10; i++)
+      doc.add(i);
+    for (int i = 0; i < 4; i++)
+      doc.remove(0);
+
+    auto stats = doc.stats();
+
+    REQUIRE(stats.slotsUsed == 6);
+    REQUIRE(stats.bytesWasted == sizeofPool(ARDUINOJSON_POOL_CAPACITY - 6));
+  }
+
+  SECTION("bytesAllocated matches the allocator") {
+    for (int i = 0; i < 4 * ARDUINOJSON_POOL_CAPACITY + 1; i++)
+      doc.add(std::string("string") + std::to_string(i % 20));
+
+    REQUIRE(doc.stats().bytesAllocated == spy.allocatedBytes());
+    REQUIRE(doc.stats().peak == spy.allocatedBytes());
+  }
+
+  SECTION("the peak remains after compact()") {
+    deserializeJson(doc, "[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18]");
+    size_t peak = doc.stats().peak;
+    for (int i = 0; i < 16; i++)
+      doc.remove(0);
+
+    doc.compact();
+
+    auto stats = doc.stats();
+    REQUIRE(stats.bytesAllocated == sizeofPool(2));
+    REQUIRE(stats.bytesWasted == 0);
+    REQUIRE(stats.peak == peak);
+    REQUIRE(peak > stats.bytesAllocated);
+  }
+
+  SECTION("the peak remains after clear()") {
+    doc.add(1);
+    doc.clear();
+
+    REQUIRE(doc.stats().bytesAllocated == 0);
+    REQUIRE(doc.stats().peak == sizeofPool());
+  }
+}
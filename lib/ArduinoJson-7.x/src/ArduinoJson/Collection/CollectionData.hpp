@@ -96,11 +96,15 @@ class CollectionData {
     return head_;
   }
 
+  void relocateSlots(SlotId limit, ResourceManager* resources);
+
  protected:
   void appendOne(Slot<VariantData> slot, const ResourceManager* resources);
   void appendPair(Slot<VariantData> key, Slot<VariantData> value,
                   const ResourceManager* resources);
 
+  iterator iteratorAt(SlotId id, const ResourceManager* resources) const;
+
   void removeOne(iterator it, ResourceManager* resources);
   void removePair(iterator it, ResourceManager* resources);
 
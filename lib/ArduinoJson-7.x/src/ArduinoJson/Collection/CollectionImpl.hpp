@@ -30,6 +30,11 @@ inline CollectionData::iterator CollectionData::createIterator(
   return iterator(resources->getVariant(head_), head_);
 }
 
+inline CollectionData::iterator CollectionData::iteratorAt(
+    SlotId id, const ResourceManager* resources) const {
+  return iterator(resources->getVariant(id), id);
+}
+
 inline void CollectionData::appendOne(Slot<VariantData> slot,
                                       const ResourceManager* resources) {
   if (tail_ != NULL_SLOT) {
@@ -58,6 +63,9 @@ inline void CollectionData::appendPair(Slot<VariantData> key,
 }
 
 inline void CollectionData::clear(ResourceManager* resources) {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  resources->dropObjectIndex(this);
+#endif
   auto next = head_;
   while (next != NULL_SLOT) {
     auto currId = next;
@@ -70,6 +78,24 @@ inline void CollectionData::clear(ResourceManager* resources) {
   tail_ = NULL_SLOT;
 }
 
+inline void CollectionData::relocateSlots(SlotId limit,
+                                          ResourceManager* resources) {
+  VariantData* prev = nullptr;
+  auto id = head_;
+  while (id != NULL_SLOT) {
+    id = resources->relocateSlot(id, limit);
+    if (prev)
+      prev->setNext(id);
+    else
+      head_ = id;
+    tail_ = id;
+    auto slot = resources->getVariant(id);
+    slot->relocateSlots(limit, resources);
+    prev = slot;
+    id = slot->next();
+  }
+}
+
 inline Slot<VariantData> CollectionData::getPreviousSlot(
     VariantData* target, const ResourceManager* resources) const {
   auto prev = Slot<VariantData>();
@@ -104,6 +130,10 @@ inline void CollectionData::removePair(ObjectData::iterator it,
   if (it.done())
     return;
 
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  resources->dropObjectIndex(this);
+#endif
+
   auto keySlot = it.slot_;
 
   auto valueId = it.nextId_;
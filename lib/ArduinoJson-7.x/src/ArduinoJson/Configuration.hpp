@@ -135,6 +135,13 @@
 #  endif
 #endif
 
+// Number of members from which an object gets a hash table of its keys
+// The table is built on the first lookup that visits that many keys, and
+// makes the following lookups O(1). 0 disables the feature.
+#ifndef ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+#  define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 0
+#endif
+
 // Number of bytes to store the length of a string
 // https://arduinojson.org/v7/config/string_length_size/
 #ifndef ARDUINOJSON_STRING_LENGTH_SIZE
@@ -238,6 +245,19 @@
 #  define ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD 1e-5
 #endif
 
+// Parse floating point values with the Eisel-Lemire algorithm, which gives the
+// nearest value in a few integer operations, instead of multiplying by powers
+// of ten (adds a 10KB table)
+#ifndef ARDUINOJSON_FAST_FLOAT_PARSING
+#  define ARDUINOJSON_FAST_FLOAT_PARSING ARDUINOJSON_USE_LONG_LONG
+#endif
+
+// Print floating point values with the fewest digits that parse back to the
+// same value (1), or round them to a fixed number of digits (0)
+#ifndef ARDUINOJSON_SHORTEST_FLOAT
+#  define ARDUINOJSON_SHORTEST_FLOAT 0
+#endif
+
 #ifndef ARDUINOJSON_LITTLE_ENDIAN
 #  if defined(_MSC_VER) ||                           \
       (defined(__BYTE_ORDER__) &&                    \
@@ -41,6 +41,7 @@ ARDUINOJSON_END_PRIVATE_NAMESPACE
 
 #include <ArduinoJson/Deserialization/Readers/IteratorReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/RamReader.hpp>
+#include <ArduinoJson/Deserialization/Readers/InPlaceReader.hpp>
 #include <ArduinoJson/Deserialization/Readers/VariantReader.hpp>
 
 #if ARDUINOJSON_ENABLE_ARDUINO_STREAM
@@ -71,4 +72,16 @@ BoundedReader<TChar*> makeReader(TChar* input, size_t inputSize) {
   return BoundedReader<TChar*>{input, inputSize};
 }
 
+// Tells whether the reader reads from contiguous chars in RAM, exposing ptr(),
+// end() and seek(), so that the deserializer can scan several chars at a time.
+// end() returns null when the input is null-terminated.
+template <typename TReader, typename Enable = void>
+struct IsContiguousReader : false_type {};
+
+template <typename TReader>
+struct IsContiguousReader<
+    TReader,
+    enable_if_t<is_same<decltype(declval<const TReader&>().ptr()),
+                        const char*>::value>> : true_type {};
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
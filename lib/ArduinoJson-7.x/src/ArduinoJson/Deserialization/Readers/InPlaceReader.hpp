@@ -0,0 +1,29 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Wraps the reader of a mutable buffer to allow the deserializer to decode the
+// strings in place (see deserializeJsonInPlace())
+template <typename TReader>
+struct InPlaceReader : TReader {
+  explicit InPlaceReader(const TReader& reader) : TReader(reader) {}
+};
+
+template <typename TReader>
+struct IsInPlaceReader : false_type {};
+
+template <typename TReader>
+struct IsInPlaceReader<InPlaceReader<TReader>> : true_type {};
+
+template <typename TReader>
+InPlaceReader<TReader> makeInPlaceReader(const TReader& reader) {
+  return InPlaceReader<TReader>(reader);
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -29,6 +29,19 @@ class IteratorReader {
       buffer[i++] = *ptr_++;
     return i;
   }
+
+  // Direct access for the deserializer (see IsContiguousReader)
+  TIterator ptr() const {
+    return ptr_;
+  }
+
+  TIterator end() const {
+    return end_;
+  }
+
+  void seek(TIterator ptr) {
+    ptr_ = ptr;
+  }
 };
 
 template <typename TSource>
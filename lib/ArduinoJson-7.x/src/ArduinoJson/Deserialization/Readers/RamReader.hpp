@@ -35,6 +35,19 @@ struct Reader<TSource*, enable_if_t<IsCharOrVoid<TSource>::value>> {
       buffer[i] = *ptr_++;
     return length;
   }
+
+  // Direct access for the deserializer (see IsContiguousReader)
+  const char* ptr() const {
+    return ptr_;
+  }
+
+  const char* end() const {
+    return nullptr;  // null-terminated
+  }
+
+  void seek(const char* ptr) {
+    ptr_ = ptr;
+  }
 };
 
 template <typename TSource>
@@ -76,4 +76,25 @@ DeserializationError deserialize(TDestination&& dst, TChar* input,
                                       makeDeserializationOptions(args...));
 }
 
+template <
+    template <typename> class TDeserializer, typename TDestination,
+    typename... Args,
+    enable_if_t<!is_integral<typename first_or_void<Args...>::type>::value,
+                int> = 0>
+DeserializationError deserializeInPlace(TDestination&& dst, char* input,
+                                        Args... args) {
+  return doDeserialize<TDeserializer>(dst, makeInPlaceReader(makeReader(input)),
+                                      makeDeserializationOptions(args...));
+}
+
+template <template <typename> class TDeserializer, typename TDestination,
+          typename Size, typename... Args,
+          enable_if_t<is_integral<Size>::value, int> = 0>
+DeserializationError deserializeInPlace(TDestination&& dst, char* input,
+                                        Size inputSize, Args... args) {
+  return doDeserialize<TDeserializer>(
+      dst, makeInPlaceReader(makeReader(input, size_t(inputSize))),
+      makeDeserializationOptions(args...));
+}
+
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -15,6 +15,17 @@
 
 ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
 
+// The memory usage of a JsonDocument, see JsonDocument::stats()
+struct JsonDocumentStats {
+  size_t slotsUsed;       // the slots that hold a value
+  size_t slotsAllocated;  // the slots in the memory pools
+  size_t strings;         // the strings in the string pool
+  size_t stringsShared;   // the references to a string that is already stored
+  size_t bytesAllocated;  // the memory of the pools and strings
+  size_t bytesWasted;     // the memory of the slots that hold no value
+  size_t peak;            // the highest bytesAllocated since the creation
+};
+
 // A JSON document.
 // https://arduinojson.org/v7/api/jsondocument/
 class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
@@ -70,6 +81,28 @@ class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
     resources_.shrinkToFit();
   }
 
+  // Moves the values into the slots freed by the removals, then releases the
+  // unused memory.
+  // Like shrinkToFit(), this invalidates the JsonArray, JsonObject, and
+  // JsonVariant pointing into the document.
+  void compact() {
+    resources_.compact(&data_);
+  }
+
+  // Returns the memory usage of the document.
+  JsonDocumentStats stats() const {
+    JsonDocumentStats stats;
+    stats.slotsUsed = resources_.slotsUsed();
+    stats.slotsAllocated = resources_.slotsAllocated();
+    stats.strings = resources_.strings().count();
+    stats.stringsShared = resources_.strings().references() - stats.strings;
+    stats.bytesAllocated = resources_.allocatedBytes();
+    stats.bytesWasted = (stats.slotsAllocated - stats.slotsUsed) *
+                        detail::ResourceManager::slotSize;
+    stats.peak = resources_.peak();
+    return stats;
+  }
+
   // Casts the root to the specified type.
   // https://arduinojson.org/v7/api/jsondocument/as/
   template <typename T>
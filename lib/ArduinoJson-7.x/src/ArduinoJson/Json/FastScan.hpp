@@ -0,0 +1,188 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/integer.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+#include <stddef.h>  // ptrdiff_t
+#include <string.h>  // memcpy
+
+// Define these to 0 to use the word-at-a-time path, which the ESP32 runs
+#ifndef ARDUINOJSON_FAST_SCAN_SSE2
+#  if defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define ARDUINOJSON_FAST_SCAN_SSE2 1
+#  else
+#    define ARDUINOJSON_FAST_SCAN_SSE2 0
+#  endif
+#endif
+
+#ifndef ARDUINOJSON_FAST_SCAN_NEON
+#  if !ARDUINOJSON_FAST_SCAN_SSE2 && \
+      (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#    define ARDUINOJSON_FAST_SCAN_NEON 1
+#  else
+#    define ARDUINOJSON_FAST_SCAN_NEON 0
+#  endif
+#endif
+
+#if ARDUINOJSON_FAST_SCAN_SSE2
+#  include <emmintrin.h>
+#elif ARDUINOJSON_FAST_SCAN_NEON
+#  include <arm_neon.h>
+#endif
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// These functions scan an input in RAM several chars at a time.
+// When end is null, the input is null-terminated: since they must not read past
+// the terminator, they scan one char at a time.
+// Otherwise, they scan 16 chars at a time with SSE2 or NEON, or a machine word
+// at a time, and finish one char at a time.
+
+inline bool isStringSpecialChar(char c) {
+  return c == '\"' || c == '\'' || c == '\\' || static_cast<uint8_t>(c) < 0x20;
+}
+
+inline bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+#if !ARDUINOJSON_FAST_SCAN_SSE2 && !ARDUINOJSON_FAST_SCAN_NEON
+// SWAR (SIMD within a register)
+using ScanWord = conditional_t<sizeof(void*) >= 8, uint64_t, uint32_t>;
+
+inline ScanWord broadcast(uint8_t c) {
+  return ScanWord(-1) / 0xFF * c;
+}
+
+// Returns 0x80 in the bytes that are zero, 0x00 in the others
+inline ScanWord zeroBytes(ScanWord v) {
+  const ScanWord low7 = broadcast(0x7F);
+  return ~(((v & low7) + low7) | v | low7);
+}
+
+inline ScanWord loadWord(const char* p) {
+  ScanWord v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+#endif
+
+// Returns the first quote, backslash or control char
+inline const char* findStringSpecialChar(const char* p, const char* end) {
+  if (end) {
+#if ARDUINOJSON_FAST_SCAN_SSE2
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i apostrophe = _mm_set1_epi8('\'');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+    while (end - p >= 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      __m128i special = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, apostrophe)),
+          _mm_or_si128(_mm_cmpeq_epi8(v, backslash),
+                       _mm_cmpeq_epi8(_mm_min_epu8(v, maxControl), v)));
+      if (_mm_movemask_epi8(special))
+        break;
+      p += 16;
+    }
+#elif ARDUINOJSON_FAST_SCAN_NEON
+    const uint8x16_t quote = vdupq_n_u8('\"');
+    const uint8x16_t apostrophe = vdupq_n_u8('\'');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t firstPrintable = vdupq_n_u8(0x20);
+    while (end - p >= 16) {
+      uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+      uint8x16_t special = vorrq_u8(
+          vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, apostrophe)),
+          vorrq_u8(vceqq_u8(v, backslash), vcltq_u8(v, firstPrintable)));
+      uint8x8_t folded = vorr_u8(vget_low_u8(special), vget_high_u8(special));
+      if (vget_lane_u64(vreinterpret_u64_u8(folded), 0))
+        break;
+      p += 16;
+    }
+#else
+    const ScanWord quote = broadcast('\"');
+    const ScanWord apostrophe = broadcast('\'');
+    const ScanWord backslash = broadcast('\\');
+    const ScanWord control = broadcast(0xE0);
+    while (end - p >= static_cast<ptrdiff_t>(sizeof(ScanWord))) {
+      ScanWord v = loadWord(p);
+      if (zeroBytes(v ^ quote) | zeroBytes(v ^ apostrophe) |
+          zeroBytes(v ^ backslash) | zeroBytes(v & control))
+        break;
+      p += sizeof(ScanWord);
+    }
+#endif
+    while (p < end && !isStringSpecialChar(*p))
+      p++;
+    return p;
+  }
+
+  while (!isStringSpecialChar(*p))
+    p++;
+  return p;
+}
+
+// Returns the first char that is not a space, a tab, or a line break
+inline const char* findNonSpace(const char* p, const char* end) {
+  if (end) {
+#if ARDUINOJSON_FAST_SCAN_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    while (end - p >= 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      __m128i spaces = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+          _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+      if (_mm_movemask_epi8(spaces) != 0xFFFF)
+        break;
+      p += 16;
+    }
+#elif ARDUINOJSON_FAST_SCAN_NEON
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t tab = vdupq_n_u8('\t');
+    const uint8x16_t cr = vdupq_n_u8('\r');
+    const uint8x16_t lf = vdupq_n_u8('\n');
+    while (end - p >= 16) {
+      uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+      uint8x16_t spaces =
+          vorrq_u8(vorrq_u8(vceqq_u8(v, space), vceqq_u8(v, tab)),
+                   vorrq_u8(vceqq_u8(v, cr), vceqq_u8(v, lf)));
+      uint8x8_t folded = vand_u8(vget_low_u8(spaces), vget_high_u8(spaces));
+      if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) != uint64_t(-1))
+        break;
+      p += 16;
+    }
+#else
+    const ScanWord space = broadcast(' ');
+    const ScanWord tab = broadcast('\t');
+    const ScanWord cr = broadcast('\r');
+    const ScanWord lf = broadcast('\n');
+    const ScanWord all = broadcast(0x80);
+    while (end - p >= static_cast<ptrdiff_t>(sizeof(ScanWord))) {
+      ScanWord v = loadWord(p);
+      if ((zeroBytes(v ^ space) | zeroBytes(v ^ tab) | zeroBytes(v ^ cr) |
+           zeroBytes(v ^ lf)) != all)
+        break;
+      p += sizeof(ScanWord);
+    }
+#endif
+    while (p < end && isSpace(*p))
+      p++;
+    return p;
+  }
+
+  while (isSpace(*p))
+    p++;
+  return p;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -6,9 +6,11 @@
 
 #include <ArduinoJson/Deserialization/deserialize.hpp>
 #include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/FastScan.hpp>
 #include <ArduinoJson/Json/Latch.hpp>
 #include <ArduinoJson/Json/Utf16.hpp>
 #include <ArduinoJson/Json/Utf8.hpp>
+#include <ArduinoJson/Memory/InPlaceStringBuilder.hpp>
 #include <ArduinoJson/Memory/ResourceManager.hpp>
 #include <ArduinoJson/Numbers/parseNumber.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
@@ -58,6 +60,46 @@ class JsonDeserializer {
     return true;
   }
 
+  // When the input is contiguous in RAM, the string contents and the spaces
+  // are scanned several chars at a time (see FastScan.hpp)
+  using ContiguousInput = bool_constant<IsContiguousReader<TReader>::value>;
+
+  // Appends the chars up to the next quote, backslash, or control char
+  void appendPlainChars(true_type) {
+    const char* begin = latch_.position();
+    const char* end = findStringSpecialChar(begin, latch_.end());
+    stringBuilder_.append(begin, size_t(end - begin));
+    latch_.seek(end);
+  }
+
+  void appendPlainChars(false_type) {}
+
+  using InPlaceInput = bool_constant<IsInPlaceReader<TReader>::value>;
+
+  // Makes the current string overwrite the input, starting at the next char.
+  // The input is mutable since it comes from deserializeJsonInPlace().
+  void startStringInPlace(true_type) {
+    stringBuilder_.startString(const_cast<char*>(latch_.position()));
+  }
+
+  void startStringInPlace(false_type) {}
+
+  // Skips the chars up to the next quote, backslash, or control char
+  void skipPlainChars(true_type) {
+    latch_.seek(findStringSpecialChar(latch_.position(), latch_.end()));
+  }
+
+  void skipPlainChars(false_type) {}
+
+  // Skips the current char, which is a space, and the ones that follow
+  void skipSpaces(true_type) {
+    latch_.seek(findNonSpace(latch_.position(), latch_.end()));
+  }
+
+  void skipSpaces(false_type) {
+    move();
+  }
+
   template <typename TFilter>
   DeserializationError::Code parseVariant(
       VariantData& variant, TFilter filter,
@@ -401,7 +443,10 @@ class JsonDeserializer {
     const char stopChar = current();
 
     move();
+    startStringInPlace(InPlaceInput());
     for (;;) {
+      appendPlainChars(ContiguousInput());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -480,6 +525,8 @@ class JsonDeserializer {
 
     move();
     for (;;) {
+      skipPlainChars(ContiguousInput());
+
       char c = current();
       move();
       if (c == stopChar)
@@ -487,8 +534,9 @@ class JsonDeserializer {
       if (c == '\0')
         return DeserializationError::IncompleteInput;
       if (c == '\\') {
-        if (current() != '\0')
-          move();
+        if (current() == '\0')
+          return DeserializationError::IncompleteInput;
+        move();
       }
     }
 
@@ -614,7 +662,7 @@ class JsonDeserializer {
         case '\t':
         case '\r':
         case '\n':
-          move();
+          skipSpaces(ContiguousInput());
           continue;
 
 #if ARDUINOJSON_ENABLE_COMMENTS
@@ -680,7 +728,9 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  StringBuilder stringBuilder_;
+  conditional_t<IsInPlaceReader<TReader>::value, InPlaceStringBuilder,
+                StringBuilder>
+      stringBuilder_;
   bool foundSomething_;
   Latch<TReader> latch_;
   ResourceManager* resources_;
@@ -717,4 +767,21 @@ inline DeserializationError deserializeJson(TDestination&& dst, TChar* input,
                                        input, detail::forward<Args>(args)...);
 }
 
+// Parses a JSON input in a mutable buffer and puts the result in a
+// JsonDocument, without copying the strings.
+// The strings are decoded in place and the document points to them, so the
+// buffer must remain unchanged as long as the document (or any copy of it) is
+// in use. Unquoted keys and strings containing a null char are copied as usual.
+template <typename TDestination, typename... Args,
+          detail::enable_if_t<
+              detail::is_deserialize_destination<TDestination>::value, int> = 0>
+inline DeserializationError deserializeJsonInPlace(TDestination&& dst,
+                                                   char* input,
+                                                   Args&&... args) {
+  using namespace detail;
+  return deserializeInPlace<JsonDeserializer>(
+      detail::forward<TDestination>(dst), input,
+      detail::forward<Args>(args)...);
+}
+
 ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,103 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+#  include <string>
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+#  include <Arduino.h>
+#endif
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A value to extract from a JSON input, with deserializeJson(fields, input).
+// The path is a JSON Pointer (RFC 6901) without escape sequences, like
+// "/main/temp" or "/weather/0/id".
+// The constructors are constexpr, so a table of fields bound to variables with
+// static storage can be built at compile time.
+class JsonField {
+ public:
+  enum class Type : uint8_t {
+    Boolean,
+    SignedInteger,
+    UnsignedInteger,
+    Float,
+    Double,
+    CharArray,
+    StdString,
+    ArduinoString,
+  };
+
+  constexpr JsonField(const char* path, bool& value)
+      : path_(path), type_(Type::Boolean), target_(&value), size_(1) {}
+
+  template <typename T,
+            detail::enable_if_t<detail::is_integral<T>::value &&
+                                    !detail::is_same<T, bool>::value,
+                                int> = 0>
+  constexpr JsonField(const char* path, T& value)
+      : path_(path),
+        type_(detail::is_signed<T>::value ? Type::SignedInteger
+                                          : Type::UnsignedInteger),
+        target_(&value),
+        size_(sizeof(T)) {}
+
+  constexpr JsonField(const char* path, float& value)
+      : path_(path), type_(Type::Float), target_(&value), size_(sizeof(float)) {}
+
+  constexpr JsonField(const char* path, double& value)
+      : path_(path),
+        type_(Type::Double),
+        target_(&value),
+        size_(sizeof(double)) {}
+
+  // Strings longer than N-1 characters are truncated
+  template <size_t N>
+  constexpr JsonField(const char* path, char (&value)[N])
+      : path_(path), type_(Type::CharArray), target_(value), size_(N) {}
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+  constexpr JsonField(const char* path, std::string& value)
+      : path_(path), type_(Type::StdString), target_(&value), size_(0) {}
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+  constexpr JsonField(const char* path, ::String& value)
+      : path_(path), type_(Type::ArduinoString), target_(&value), size_(0) {}
+#endif
+
+  const char* path() const {
+    return path_;
+  }
+
+  Type type() const {
+    return type_;
+  }
+
+  void* target() const {
+    return target_;
+  }
+
+  // Size of the target in bytes, or capacity of a char array
+  size_t size() const {
+    return size_;
+  }
+
+ private:
+  const char* path_;
+  Type type_;
+  void* target_;
+  size_t size_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,835 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/JsonField.hpp>
+#include <ArduinoJson/Json/Latch.hpp>
+#include <ArduinoJson/Json/Utf16.hpp>
+#include <ArduinoJson/Json/Utf8.hpp>
+#include <ArduinoJson/Numbers/parseNumber.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/Strings/FixedStringBuilder.hpp>
+
+#include <string.h>  // strncmp
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Writes a string in a std::string or a String
+template <typename TString>
+class WriterStringBuilder {
+ public:
+  WriterStringBuilder(TString& str) : writer_(str) {}
+
+  void append(char c) {
+    writer_.write(uint8_t(c));
+  }
+
+  bool isValid() const {
+    return true;
+  }
+
+ private:
+  Writer<TString> writer_;
+};
+
+// Parses a JSON input in a single pass and stores the values of the given
+// fields, without building a JsonDocument.
+// The current location in the input is always the prefix of a field's path, so
+// the deserializer passes around a field and the length of the prefix.
+template <typename TReader>
+class JsonFieldDeserializer {
+ public:
+  JsonFieldDeserializer(const JsonField* fields, size_t count, TReader reader)
+      : fields_(fields),
+        fieldCount_(count),
+        foundSomething_(false),
+        latch_(reader) {}
+
+  DeserializationError parse(DeserializationOption::NestingLimit nestingLimit) {
+    return parseVariant(nullptr, 0, nestingLimit);
+  }
+
+ private:
+  char current() {
+    return latch_.current();
+  }
+
+  void move() {
+    latch_.clear();
+  }
+
+  bool eat(char charToSkip) {
+    if (current() != charToSkip)
+      return false;
+    move();
+    return true;
+  }
+
+  // The first `length` chars of field->path() are the location of the value,
+  // field is null for the root
+  DeserializationError::Code parseVariant(
+      const JsonField* field, size_t length,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    if (field && field->path()[length] == '\0')
+      return parseValue(*field, nestingLimit);
+
+    switch (current()) {
+      case '[':
+        return parseArray(field, length, nestingLimit);
+
+      case '{':
+        return parseObject(field, length, nestingLimit);
+
+      default:
+        return skipVariant(nestingLimit);
+    }
+  }
+
+  DeserializationError::Code parseValue(
+      const JsonField& field,
+      DeserializationOption::NestingLimit nestingLimit) {
+    switch (current()) {
+      case '\"':
+      case '\'':
+        return parseStringValue(field);
+
+      case 't':
+        storeBoolean(field, true);
+        return skipKeyword("true");
+
+      case 'f':
+        storeBoolean(field, false);
+        return skipKeyword("false");
+
+      case 'n':
+        return skipKeyword("null");
+
+      case '[':
+      case '{':
+        return skipVariant(nestingLimit);
+
+      default:
+        return parseNumericValue(field);
+    }
+  }
+
+  DeserializationError::Code parseArray(
+      const JsonField* field, size_t length,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening braket
+    ARDUINOJSON_ASSERT(current() == '[');
+    move();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Empty array?
+    if (eat(']'))
+      return DeserializationError::Ok;
+
+    // Read each value
+    for (size_t index = 0;; index++) {
+      size_t childLength;
+      auto child = findElement(field, length, index, childLength);
+
+      // 1 - Parse or skip value
+      if (child)
+        err = parseVariant(child, childLength, nestingLimit.decrement());
+      else
+        err = skipVariant(nestingLimit.decrement());
+      if (err)
+        return err;
+
+      // 2 - Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // 3 - More values?
+      if (eat(']'))
+        return DeserializationError::Ok;
+      if (!eat(','))
+        return DeserializationError::InvalidInput;
+    }
+  }
+
+  DeserializationError::Code parseObject(
+      const JsonField* field, size_t length,
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening brace
+    ARDUINOJSON_ASSERT(current() == '{');
+    move();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Empty object?
+    if (eat('}'))
+      return DeserializationError::Ok;
+
+    // Read each key value pair
+    for (;;) {
+      // Parse key
+      FixedStringBuilder key(key_, sizeof(key_));
+      err = parseKey(key);
+      if (err)
+        return err;
+      size_t keyLength = key.finish();
+
+      // Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // Colon
+      if (!eat(':'))
+        return DeserializationError::InvalidInput;
+
+      // Parse or skip value
+      const JsonField* child = nullptr;
+      if (!key.truncated())
+        child = findMember(field, length, keyLength);
+      if (child)
+        err = parseVariant(child, length + 1 + keyLength,
+                           nestingLimit.decrement());
+      else
+        err = skipVariant(nestingLimit.decrement());
+      if (err)
+        return err;
+
+      // Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // More keys/values?
+      if (eat('}'))
+        return DeserializationError::Ok;
+      if (!eat(','))
+        return DeserializationError::InvalidInput;
+
+      // Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+    }
+  }
+
+  // Returns the first field under the current location, whose next segment is
+  // the key in key_
+  const JsonField* findMember(const JsonField* parent, size_t length,
+                              size_t keyLength) const {
+    for (size_t i = 0; i < fieldCount_; i++) {
+      const char* path = fields_[i].path();
+      if (!isUnder(path, parent, length))
+        continue;
+      const char* segment = path + length + 1;
+      if (strncmp(segment, key_, keyLength) == 0 &&
+          isEndOfSegment(segment[keyLength]))
+        return &fields_[i];
+    }
+    return nullptr;
+  }
+
+  // Returns the first field under the current location, whose next segment is
+  // the index
+  const JsonField* findElement(const JsonField* parent, size_t length,
+                               size_t index, size_t& childLength) const {
+    for (size_t i = 0; i < fieldCount_; i++) {
+      const char* path = fields_[i].path();
+      if (!isUnder(path, parent, length))
+        continue;
+      const char* segment = path + length + 1;
+      size_t n = 0;
+      size_t value = 0;
+      while (isBetween(segment[n], '0', '9')) {
+        value = value * 10 + size_t(segment[n] - '0');
+        n++;
+      }
+      if (n > 0 && value == index && isEndOfSegment(segment[n])) {
+        childLength = length + 1 + n;
+        return &fields_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  static bool isUnder(const char* path, const JsonField* parent,
+                      size_t length) {
+    if (parent && strncmp(path, parent->path(), length) != 0)
+      return false;
+    return path[length] == '/';
+  }
+
+  static bool isEndOfSegment(char c) {
+    return c == '/' || c == '\0';
+  }
+
+  DeserializationError::Code parseStringValue(const JsonField& field) {
+    switch (field.type()) {
+      case JsonField::Type::CharArray: {
+        FixedStringBuilder str(static_cast<char*>(field.target()),
+                               field.size());
+        auto err = parseQuotedString(str);
+        str.finish();
+        return err;
+      }
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+      case JsonField::Type::StdString: {
+        WriterStringBuilder<std::string> str(
+            *static_cast<std::string*>(field.target()));
+        return parseQuotedString(str);
+      }
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+      case JsonField::Type::ArduinoString: {
+        WriterStringBuilder<::String> str(
+            *static_cast<::String*>(field.target()));
+        return parseQuotedString(str);
+      }
+#endif
+
+      default:
+        return skipQuotedString();
+    }
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code parseKey(TStringBuilder& str) {
+    if (isQuote(current())) {
+      return parseQuotedString(str);
+    } else {
+      return parseNonQuotedString(str);
+    }
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code parseQuotedString(TStringBuilder& str) {
+#if ARDUINOJSON_DECODE_UNICODE
+    Utf16::Codepoint codepoint;
+    DeserializationError::Code err;
+#endif
+    const char stopChar = current();
+
+    move();
+    for (;;) {
+      char c = current();
+      move();
+      if (c == stopChar)
+        break;
+
+      if (c == '\0')
+        return DeserializationError::IncompleteInput;
+
+      if (c == '\\') {
+        c = current();
+
+        if (c == '\0')
+          return DeserializationError::IncompleteInput;
+
+        if (c == 'u') {
+#if ARDUINOJSON_DECODE_UNICODE
+          move();
+          uint16_t codeunit;
+          err = parseHex4(codeunit);
+          if (err)
+            return err;
+          if (codepoint.append(codeunit))
+            Utf8::encodeCodepoint(codepoint.value(), str);
+#else
+          str.append('\\');
+#endif
+          continue;
+        }
+
+        // replace char
+        c = EscapeSequence::unescapeChar(c);
+        if (c == '\0')
+          return DeserializationError::InvalidInput;
+        move();
+      }
+
+      str.append(c);
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code parseNonQuotedString(TStringBuilder& str) {
+    char c = current();
+    ARDUINOJSON_ASSERT(c);
+
+    if (canBeInNonQuotedString(c)) {  // no quotes
+      do {
+        move();
+        str.append(c);
+        c = current();
+      } while (canBeInNonQuotedString(c));
+    } else {
+      return DeserializationError::InvalidInput;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code parseNumericValue(const JsonField& field) {
+    uint8_t n = 0;
+
+    char c = current();
+    while (canBeInNumber(c) && n < 63) {
+      move();
+      buffer_[n++] = c;
+      c = current();
+    }
+    buffer_[n] = 0;
+
+    auto number = parseNumber(buffer_);
+    if (number.type() == NumberType::Invalid)
+      return DeserializationError::InvalidInput;
+
+    storeNumber(field, number);
+    return DeserializationError::Ok;
+  }
+
+  // Same conversions as JsonVariant::as<T>()
+  static void storeNumber(const JsonField& field, const Number& number) {
+    void* p = field.target();
+    switch (field.type()) {
+      case JsonField::Type::Boolean:
+        *static_cast<bool*>(p) = number.convertTo<JsonFloat>() != 0;
+        break;
+
+      case JsonField::Type::SignedInteger:
+        switch (field.size()) {
+          case 1:
+            *static_cast<int8_t*>(p) = number.convertTo<int8_t>();
+            break;
+          case 2:
+            *static_cast<int16_t*>(p) = number.convertTo<int16_t>();
+            break;
+          case 4:
+            *static_cast<int32_t*>(p) = number.convertTo<int32_t>();
+            break;
+          default:
+            *static_cast<int64_t*>(p) = number.convertTo<int64_t>();
+            break;
+        }
+        break;
+
+      case JsonField::Type::UnsignedInteger:
+        switch (field.size()) {
+          case 1:
+            *static_cast<uint8_t*>(p) = number.convertTo<uint8_t>();
+            break;
+          case 2:
+            *static_cast<uint16_t*>(p) = number.convertTo<uint16_t>();
+            break;
+          case 4:
+            *static_cast<uint32_t*>(p) = number.convertTo<uint32_t>();
+            break;
+          default:
+            *static_cast<uint64_t*>(p) = number.convertTo<uint64_t>();
+            break;
+        }
+        break;
+
+      case JsonField::Type::Float:
+        *static_cast<float*>(p) = number.convertTo<float>();
+        break;
+
+      case JsonField::Type::Double:
+        *static_cast<double*>(p) = number.convertTo<double>();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  static void storeBoolean(const JsonField& field, bool value) {
+    if (field.type() == JsonField::Type::Boolean)
+      *static_cast<bool*>(field.target()) = value;
+    else
+      storeNumber(field, Number(JsonUInt(value)));
+  }
+
+  DeserializationError::Code skipVariant(
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    switch (current()) {
+      case '[':
+        return skipArray(nestingLimit);
+
+      case '{':
+        return skipObject(nestingLimit);
+
+      case '\"':
+      case '\'':
+        return skipQuotedString();
+
+      case 't':
+        return skipKeyword("true");
+
+      case 'f':
+        return skipKeyword("false");
+
+      case 'n':
+        return skipKeyword("null");
+
+      default:
+        return skipNumericValue();
+    }
+  }
+
+  DeserializationError::Code skipArray(
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening braket
+    ARDUINOJSON_ASSERT(current() == '[');
+    move();
+
+    // Read each value
+    for (;;) {
+      // 1 - Skip value
+      err = skipVariant(nestingLimit.decrement());
+      if (err)
+        return err;
+
+      // 2 - Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // 3 - More values?
+      if (eat(']'))
+        return DeserializationError::Ok;
+      if (!eat(','))
+        return DeserializationError::InvalidInput;
+    }
+  }
+
+  DeserializationError::Code skipObject(
+      DeserializationOption::NestingLimit nestingLimit) {
+    DeserializationError::Code err;
+
+    if (nestingLimit.reached())
+      return DeserializationError::TooDeep;
+
+    // Skip opening brace
+    ARDUINOJSON_ASSERT(current() == '{');
+    move();
+
+    // Skip spaces
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    // Empty object?
+    if (eat('}'))
+      return DeserializationError::Ok;
+
+    // Read each key value pair
+    for (;;) {
+      // Skip key
+      err = skipKey();
+      if (err)
+        return err;
+
+      // Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // Colon
+      if (!eat(':'))
+        return DeserializationError::InvalidInput;
+
+      // Skip value
+      err = skipVariant(nestingLimit.decrement());
+      if (err)
+        return err;
+
+      // Skip spaces
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      // More keys/values?
+      if (eat('}'))
+        return DeserializationError::Ok;
+      if (!eat(','))
+        return DeserializationError::InvalidInput;
+
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+    }
+  }
+
+  DeserializationError::Code skipKey() {
+    if (isQuote(current())) {
+      return skipQuotedString();
+    } else {
+      return skipNonQuotedString();
+    }
+  }
+
+  DeserializationError::Code skipQuotedString() {
+    const char stopChar = current();
+
+    move();
+    for (;;) {
+      char c = current();
+      move();
+      if (c == stopChar)
+        break;
+      if (c == '\0')
+        return DeserializationError::IncompleteInput;
+      if (c == '\\') {
+        if (current() != '\0')
+          move();
+      }
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code skipNonQuotedString() {
+    char c = current();
+    while (canBeInNonQuotedString(c)) {
+      move();
+      c = current();
+    }
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code skipNumericValue() {
+    char c = current();
+    while (canBeInNumber(c)) {
+      move();
+      c = current();
+    }
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code parseHex4(uint16_t& result) {
+    result = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+      char digit = current();
+      if (!digit)
+        return DeserializationError::IncompleteInput;
+      uint8_t value = decodeHex(digit);
+      if (value > 0x0F)
+        return DeserializationError::InvalidInput;
+      result = uint16_t((result << 4) | value);
+      move();
+    }
+    return DeserializationError::Ok;
+  }
+
+  static inline bool isBetween(char c, char min, char max) {
+    return min <= c && c <= max;
+  }
+
+  static inline bool canBeInNumber(char c) {
+    return isBetween(c, '0', '9') || c == '+' || c == '-' || c == '.' ||
+#if ARDUINOJSON_ENABLE_NAN || ARDUINOJSON_ENABLE_INFINITY
+           isBetween(c, 'A', 'Z') || isBetween(c, 'a', 'z');
+#else
+           c == 'e' || c == 'E';
+#endif
+  }
+
+  static inline bool canBeInNonQuotedString(char c) {
+    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
+           isBetween(c, 'A', 'Z');
+  }
+
+  static inline bool isQuote(char c) {
+    return c == '\'' || c == '\"';
+  }
+
+  static inline uint8_t decodeHex(char c) {
+    if (c < 'A')
+      return uint8_t(c - '0');
+    c = char(c & ~0x20);  // uppercase
+    return uint8_t(c - 'A' + 10);
+  }
+
+  DeserializationError::Code skipSpacesAndComments() {
+    for (;;) {
+      switch (current()) {
+        // end of string
+        case '\0':
+          return foundSomething_ ? DeserializationError::IncompleteInput
+                                 : DeserializationError::EmptyInput;
+
+        // spaces
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          move();
+          continue;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+        // comments
+        case '/':
+          move();  // skip '/'
+          switch (current()) {
+            // block comment
+            case '*': {
+              move();  // skip '*'
+              bool wasStar = false;
+              for (;;) {
+                char c = current();
+                if (c == '\0')
+                  return DeserializationError::IncompleteInput;
+                if (c == '/' && wasStar) {
+                  move();
+                  break;
+                }
+                wasStar = c == '*';
+                move();
+              }
+              break;
+            }
+
+            // trailing comment
+            case '/':
+              // no need to skip "//"
+              for (;;) {
+                move();
+                char c = current();
+                if (c == '\0')
+                  return DeserializationError::IncompleteInput;
+                if (c == '\n')
+                  break;
+              }
+              break;
+
+            // not a comment, just a '/'
+            default:
+              return DeserializationError::InvalidInput;
+          }
+          break;
+#endif
+
+        default:
+          foundSomething_ = true;
+          return DeserializationError::Ok;
+      }
+    }
+  }
+
+  DeserializationError::Code skipKeyword(const char* s) {
+    while (*s) {
+      char c = current();
+      if (c == '\0')
+        return DeserializationError::IncompleteInput;
+      if (*s != c)
+        return DeserializationError::InvalidInput;
+      ++s;
+      move();
+    }
+    return DeserializationError::Ok;
+  }
+
+  const JsonField* fields_;
+  size_t fieldCount_;
+  bool foundSomething_;
+  Latch<TReader> latch_;
+  char key_[64];     // keys are compared before parsing the value, so one
+                     // buffer is enough for all levels
+  char buffer_[64];  // using a member instead of a local variable because it
+                     // ended in the recursive path after compiler inlined the
+                     // code
+};
+
+template <typename TReader>
+DeserializationError doDeserializeFields(
+    const JsonField* fields, size_t count, TReader reader,
+    DeserializationOption::NestingLimit nestingLimit) {
+  return JsonFieldDeserializer<TReader>(fields, count, reader)
+      .parse(nestingLimit);
+}
+
+template <typename TStream, typename... Args,
+          enable_if_t<!is_integral<typename first_or_void<Args...>::type>::value,
+                      int> = 0>
+DeserializationError deserializeFields(const JsonField* fields, size_t count,
+                                       TStream&& input, Args... args) {
+  return doDeserializeFields(fields, count,
+                             makeReader(detail::forward<TStream>(input)),
+                             makeDeserializationOptions(args...).nestingLimit);
+}
+
+template <typename TChar, typename Size, typename... Args,
+          enable_if_t<is_integral<Size>::value, int> = 0>
+DeserializationError deserializeFields(const JsonField* fields, size_t count,
+                                       TChar* input, Size inputSize,
+                                       Args... args) {
+  return doDeserializeFields(fields, count,
+                             makeReader(input, size_t(inputSize)),
+                             makeDeserializationOptions(args...).nestingLimit);
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON input and stores the values of the fields, in a single pass
+// and without a JsonDocument. Fields missing from the input keep their value.
+template <size_t N, typename... Args>
+inline DeserializationError deserializeJson(const JsonField (&fields)[N],
+                                            Args&&... args) {
+  return detail::deserializeFields(fields, N, detail::forward<Args>(args)...);
+}
+
+// Parses a JSON input and stores the values of the fields, in a single pass
+// and without a JsonDocument. Fields missing from the input keep their value.
+template <size_t N, typename TChar, typename... Args>
+inline DeserializationError deserializeJson(const JsonField (&fields)[N],
+                                            TChar* input, Args&&... args) {
+  return detail::deserializeFields(fields, N, input,
+                                   detail::forward<Args>(args)...);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
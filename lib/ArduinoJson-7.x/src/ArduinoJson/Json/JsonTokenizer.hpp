@@ -0,0 +1,587 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationError.hpp>
+#include <ArduinoJson/Deserialization/DeserializationOptions.hpp>
+#include <ArduinoJson/Deserialization/Reader.hpp>
+#include <ArduinoJson/Json/EscapeSequence.hpp>
+#include <ArduinoJson/Json/Latch.hpp>
+#include <ArduinoJson/Json/Utf16.hpp>
+#include <ArduinoJson/Json/Utf8.hpp>
+#include <ArduinoJson/Numbers/parseNumber.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Strings/FixedStringBuilder.hpp>
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// The tokens returned by JsonTokenizer::next()
+enum class JsonToken : uint8_t {
+  None,  // next() hasn't been called yet
+  BeginObject,
+  EndObject,
+  BeginArray,
+  EndArray,
+  Key,
+  String,
+  Number,
+  Boolean,
+  Null,
+  End,    // the root value is complete, the rest of the input is not read
+  Error,  // see error()
+};
+
+// Reads a JSON input one token at a time, without building a JsonDocument.
+// The memory usage doesn't depend on the input: keys, strings and numbers go
+// in a buffer of N chars and are truncated if they don't fit.
+template <typename TReader, size_t N = 64>
+class JsonTokenizer {
+  static_assert(N > 1, "The buffer must have room for the terminator");
+
+ public:
+  explicit JsonTokenizer(TReader reader,
+                         DeserializationOption::NestingLimit nestingLimit =
+                             DeserializationOption::NestingLimit())
+      : latch_(reader),
+        token_(JsonToken::None),
+        error_(DeserializationError::Ok),
+        depth_(0),
+        maxDepth_(toDepth(nestingLimit)),
+        foundSomething_(false),
+        afterKey_(false),
+        afterValue_(false),
+        truncated_(false),
+        length_(0),
+        containers_() {
+    buffer_[0] = 0;
+  }
+
+  // Reads the next token.
+  // Once it returns End or Error, it keeps returning the same token.
+  JsonToken next() {
+    if (token_ == JsonToken::End || token_ == JsonToken::Error)
+      return token_;
+    auto err = parseToken();
+    if (err) {
+      error_ = err;
+      token_ = JsonToken::Error;
+    }
+    return token_;
+  }
+
+  // Skips the value of the last Key, or the remainder of the container that
+  // the last BeginObject or BeginArray opened.
+  // Afterward, the last token is the one that ends the skipped value.
+  DeserializationError skip() {
+    switch (token_) {
+      case JsonToken::Key:
+        next();
+        if (token_ != JsonToken::BeginObject &&
+            token_ != JsonToken::BeginArray)
+          return error_;
+        break;
+
+      case JsonToken::BeginObject:
+      case JsonToken::BeginArray:
+        break;
+
+      default:
+        return error_;
+    }
+
+    uint8_t depth = depth_;
+    while (depth_ >= depth && next() != JsonToken::Error) {
+    }
+    return error_;
+  }
+
+  // Returns the last token
+  JsonToken token() const {
+    return token_;
+  }
+
+  // Returns the reason of the Error token
+  DeserializationError error() const {
+    return error_;
+  }
+
+  // Returns the number of containers open, including the one that the last
+  // BeginObject or BeginArray opened, but not the one that the last EndObject
+  // or EndArray closed
+  uint8_t depth() const {
+    return depth_;
+  }
+
+  // Returns true if the innermost container is an object
+  bool inObject() const {
+    return depth_ > 0 && isObject(uint8_t(depth_ - 1));
+  }
+
+  // Returns the text of the last Key, String, or Number token
+  const char* string() const {
+    return buffer_;
+  }
+
+  // Returns the length of string()
+  size_t size() const {
+    return length_;
+  }
+
+  // Returns true if string() was truncated to fit in the buffer
+  bool truncated() const {
+    return truncated_;
+  }
+
+  // Returns the value of the last Number or Boolean token, converted like
+  // JsonVariant::as<T>() does
+  template <typename T>
+  detail::enable_if_t<detail::is_integral<T>::value &&
+                          !detail::is_same<T, bool>::value,
+                      T>
+  as() const {
+    return number_.template convertTo<T>();
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_floating_point<T>::value, T> as() const {
+    return number_.template convertTo<T>();
+  }
+
+  template <typename T>
+  detail::enable_if_t<detail::is_same<T, bool>::value, T> as() const {
+    return number_.template convertTo<JsonFloat>() != 0;
+  }
+
+ private:
+  char current() {
+    return latch_.current();
+  }
+
+  void move() {
+    latch_.clear();
+  }
+
+  bool eat(char charToSkip) {
+    if (current() != charToSkip)
+      return false;
+    move();
+    return true;
+  }
+
+  static uint8_t toDepth(DeserializationOption::NestingLimit nestingLimit) {
+    uint8_t depth = 0;
+    while (!nestingLimit.reached()) {
+      nestingLimit = nestingLimit.decrement();
+      depth++;
+    }
+    return depth;
+  }
+
+  bool isObject(uint8_t level) const {
+    return (containers_[level / 8] >> (level % 8)) & 1;
+  }
+
+  DeserializationError::Code parseToken() {
+    DeserializationError::Code err;
+
+    // The root value is complete?
+    if (depth_ == 0 && token_ != JsonToken::None) {
+      token_ = JsonToken::End;
+      return DeserializationError::Ok;
+    }
+
+    resetValue();
+
+    err = skipSpacesAndComments();
+    if (err)
+      return err;
+
+    if (depth_ == 0)
+      return parseValue();
+
+    if (afterKey_) {
+      afterKey_ = false;
+
+      // Colon
+      if (!eat(':'))
+        return DeserializationError::InvalidInput;
+
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+
+      return parseValue();
+    }
+
+    bool object = isObject(uint8_t(depth_ - 1));
+    char closingChar = object ? '}' : ']';
+
+    if (eat(closingChar))
+      return endContainer(object ? JsonToken::EndObject : JsonToken::EndArray);
+
+    // More keys/values?
+    if (afterValue_) {
+      if (!eat(','))
+        return DeserializationError::InvalidInput;
+
+      err = skipSpacesAndComments();
+      if (err)
+        return err;
+    }
+
+    if (!object)
+      return parseValue();
+
+    detail::FixedStringBuilder key(buffer_, N);
+    if (isQuote(current()))
+      err = parseQuotedString(key);
+    else
+      err = parseNonQuotedString(key);
+    if (err)
+      return err;
+    finishString(key);
+
+    afterKey_ = true;
+    afterValue_ = false;
+    token_ = JsonToken::Key;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code parseValue() {
+    DeserializationError::Code err;
+
+    afterValue_ = true;
+
+    switch (current()) {
+      case '[':
+        return beginContainer(false);
+
+      case '{':
+        return beginContainer(true);
+
+      case '\"':
+      case '\'': {
+        detail::FixedStringBuilder str(buffer_, N);
+        err = parseQuotedString(str);
+        if (err)
+          return err;
+        finishString(str);
+        token_ = JsonToken::String;
+        return DeserializationError::Ok;
+      }
+
+      case 't':
+        number_ = detail::Number(JsonUInt(1));
+        token_ = JsonToken::Boolean;
+        return skipKeyword("true");
+
+      case 'f':
+        number_ = detail::Number(JsonUInt(0));
+        token_ = JsonToken::Boolean;
+        return skipKeyword("false");
+
+      case 'n':
+        token_ = JsonToken::Null;
+        return skipKeyword("null");
+
+      default:
+        return parseNumericValue();
+    }
+  }
+
+  DeserializationError::Code beginContainer(bool object) {
+    if (depth_ >= maxDepth_)
+      return DeserializationError::TooDeep;
+
+    // Skip opening brace or bracket
+    move();
+
+    uint8_t mask = uint8_t(1 << (depth_ % 8));
+    if (object)
+      containers_[depth_ / 8] |= mask;
+    else
+      containers_[depth_ / 8] &= uint8_t(~mask);
+    depth_++;
+
+    afterValue_ = false;
+    token_ = object ? JsonToken::BeginObject : JsonToken::BeginArray;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code endContainer(JsonToken token) {
+    depth_--;
+    afterValue_ = true;
+    token_ = token;
+    return DeserializationError::Ok;
+  }
+
+  void resetValue() {
+    number_ = detail::Number();
+    buffer_[0] = 0;
+    length_ = 0;
+    truncated_ = false;
+  }
+
+  void finishString(detail::FixedStringBuilder& str) {
+    length_ = str.finish();
+    truncated_ = str.truncated();
+  }
+
+  DeserializationError::Code parseNumericValue() {
+    size_t n = 0;
+
+    char c = current();
+    while (canBeInNumber(c) && n < N - 1) {
+      move();
+      buffer_[n++] = c;
+      c = current();
+    }
+    buffer_[n] = 0;
+    length_ = n;
+
+    number_ = detail::parseNumber(buffer_);
+    if (number_.type() == detail::NumberType::Invalid)
+      return DeserializationError::InvalidInput;
+
+    token_ = JsonToken::Number;
+    return DeserializationError::Ok;
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code parseQuotedString(TStringBuilder& str) {
+#if ARDUINOJSON_DECODE_UNICODE
+    detail::Utf16::Codepoint codepoint;
+    DeserializationError::Code err;
+#endif
+    const char stopChar = current();
+
+    move();
+    for (;;) {
+      char c = current();
+      move();
+      if (c == stopChar)
+        break;
+
+      if (c == '\0')
+        return DeserializationError::IncompleteInput;
+
+      if (c == '\\') {
+        c = current();
+
+        if (c == '\0')
+          return DeserializationError::IncompleteInput;
+
+        if (c == 'u') {
+#if ARDUINOJSON_DECODE_UNICODE
+          move();
+          uint16_t codeunit;
+          err = parseHex4(codeunit);
+          if (err)
+            return err;
+          if (codepoint.append(codeunit))
+            detail::Utf8::encodeCodepoint(codepoint.value(), str);
+#else
+          str.append('\\');
+#endif
+          continue;
+        }
+
+        // replace char
+        c = detail::EscapeSequence::unescapeChar(c);
+        if (c == '\0')
+          return DeserializationError::InvalidInput;
+        move();
+      }
+
+      str.append(c);
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code parseNonQuotedString(TStringBuilder& str) {
+    char c = current();
+    ARDUINOJSON_ASSERT(c);
+
+    if (canBeInNonQuotedString(c)) {  // no quotes
+      do {
+        move();
+        str.append(c);
+        c = current();
+      } while (canBeInNonQuotedString(c));
+    } else {
+      return DeserializationError::InvalidInput;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code parseHex4(uint16_t& result) {
+    result = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+      char digit = current();
+      if (!digit)
+        return DeserializationError::IncompleteInput;
+      uint8_t value = decodeHex(digit);
+      if (value > 0x0F)
+        return DeserializationError::InvalidInput;
+      result = uint16_t((result << 4) | value);
+      move();
+    }
+    return DeserializationError::Ok;
+  }
+
+  static inline bool isBetween(char c, char min, char max) {
+    return min <= c && c <= max;
+  }
+
+  static inline bool canBeInNumber(char c) {
+    return isBetween(c, '0', '9') || c == '+' || c == '-' || c == '.' ||
+#if ARDUINOJSON_ENABLE_NAN || ARDUINOJSON_ENABLE_INFINITY
+           isBetween(c, 'A', 'Z') || isBetween(c, 'a', 'z');
+#else
+           c == 'e' || c == 'E';
+#endif
+  }
+
+  static inline bool canBeInNonQuotedString(char c) {
+    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
+           isBetween(c, 'A', 'Z');
+  }
+
+  static inline bool isQuote(char c) {
+    return c == '\'' || c == '\"';
+  }
+
+  static inline uint8_t decodeHex(char c) {
+    if (c < 'A')
+      return uint8_t(c - '0');
+    c = char(c & ~0x20);  // uppercase
+    return uint8_t(c - 'A' + 10);
+  }
+
+  DeserializationError::Code skipSpacesAndComments() {
+    for (;;) {
+      switch (current()) {
+        // end of string
+        case '\0':
+          return foundSomething_ ? DeserializationError::IncompleteInput
+                                 : DeserializationError::EmptyInput;
+
+        // spaces
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          move();
+          continue;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+        // comments
+        case '/':
+          move();  // skip '/'
+          switch (current()) {
+            // block comment
+            case '*': {
+              move();  // skip '*'
+              bool wasStar = false;
+              for (;;) {
+                char c = current();
+                if (c == '\0')
+                  return DeserializationError::IncompleteInput;
+                if (c == '/' && wasStar) {
+                  move();
+                  break;
+                }
+                wasStar = c == '*';
+                move();
+              }
+              break;
+            }
+
+            // trailing comment
+            case '/':
+              // no need to skip "//"
+              for (;;) {
+                move();
+                char c = current();
+                if (c == '\0')
+                  return DeserializationError::IncompleteInput;
+                if (c == '\n')
+                  break;
+              }
+              break;
+
+            // not a comment, just a '/'
+            default:
+              return DeserializationError::InvalidInput;
+          }
+          break;
+#endif
+
+        default:
+          foundSomething_ = true;
+          return DeserializationError::Ok;
+      }
+    }
+  }
+
+  DeserializationError::Code skipKeyword(const char* s) {
+    while (*s) {
+      char c = current();
+      if (c == '\0')
+        return DeserializationError::IncompleteInput;
+      if (*s != c)
+        return DeserializationError::InvalidInput;
+      ++s;
+      move();
+    }
+    return DeserializationError::Ok;
+  }
+
+  detail::Latch<TReader> latch_;
+  detail::Number number_;
+  JsonToken token_;
+  DeserializationError error_;
+  uint8_t depth_;
+  uint8_t maxDepth_;
+  bool foundSomething_;
+  bool afterKey_;    // the value of a key is expected
+  bool afterValue_;  // a comma or the end of the container is expected
+  bool truncated_;
+  size_t length_;
+  uint8_t containers_[32];  // one bit per level, set for objects
+  char buffer_[N];
+};
+
+// Creates a JsonTokenizer that reads a JSON input
+template <size_t N = 64, typename TInput>
+JsonTokenizer<detail::Reader<detail::remove_reference_t<TInput>>, N>
+makeJsonTokenizer(TInput&& input, DeserializationOption::NestingLimit
+                                      nestingLimit = {}) {
+  return JsonTokenizer<detail::Reader<detail::remove_reference_t<TInput>>, N>(
+      detail::makeReader(detail::forward<TInput>(input)), nestingLimit);
+}
+
+// Creates a JsonTokenizer that reads a JSON input
+template <size_t N = 64, typename TChar>
+JsonTokenizer<detail::Reader<TChar*>, N> makeJsonTokenizer(
+    TChar* input, DeserializationOption::NestingLimit nestingLimit = {}) {
+  return JsonTokenizer<detail::Reader<TChar*>, N>(detail::makeReader(input),
+                                                  nestingLimit);
+}
+
+// Creates a JsonTokenizer that reads a JSON input of the given size
+template <size_t N = 64, typename TChar, typename Size,
+          detail::enable_if_t<detail::is_integral<Size>::value, int> = 0>
+JsonTokenizer<detail::BoundedReader<TChar*>, N> makeJsonTokenizer(
+    TChar* input, Size inputSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  return JsonTokenizer<detail::BoundedReader<TChar*>, N>(
+      detail::makeReader(input, size_t(inputSize)), nestingLimit);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
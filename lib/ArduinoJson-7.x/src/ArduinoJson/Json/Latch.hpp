@@ -32,6 +32,29 @@ class Latch {
     return current_;
   }
 
+  // The following functions require a contiguous reader (see
+  // IsContiguousReader)
+
+  // Returns the address of the current char, which must not be the end of the
+  // input, and unloads it
+  const char* position() {
+    if (loaded_) {
+      ARDUINOJSON_ASSERT(current_ != 0);
+      loaded_ = false;
+      return reader_.ptr() - 1;
+    }
+    return reader_.ptr();
+  }
+
+  const char* end() const {
+    return reader_.end();
+  }
+
+  void seek(const char* ptr) {
+    ARDUINOJSON_ASSERT(!loaded_);
+    reader_.seek(ptr);
+  }
+
  private:
   void load() {
     ARDUINOJSON_ASSERT(!ended_);
@@ -10,6 +10,7 @@
 #include <ArduinoJson/Json/EscapeSequence.hpp>
 #include <ArduinoJson/Numbers/FloatParts.hpp>
 #include <ArduinoJson/Numbers/JsonInteger.hpp>
+#include <ArduinoJson/Numbers/shortestDecimal.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/attributes.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
@@ -66,12 +67,76 @@ class TextFormatter {
 
   template <typename T>
   void writeFloat(T value) {
+#if ARDUINOJSON_SHORTEST_FLOAT
+    writeShortestFloat(value);
+#else
     writeFloat(JsonFloat(value), sizeof(T) >= 8 ? 9 : 6);
+#endif
   }
 
   void writeFloat(JsonFloat value, int8_t decimalPlaces) {
-    if (isnan(value))
-      return writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
+    if (writeFloatSpecialValue(value))
+      return;
+
+    auto parts = decomposeFloat(value, decimalPlaces);
+
+    writeInteger(parts.integral);
+    if (parts.decimalPlaces)
+      writeDecimals(parts.decimal, parts.decimalPlaces);
+
+    if (parts.exponent) {
+      writeRaw('e');
+      writeInteger(parts.exponent);
+    }
+  }
+
+  // Writes the fewest digits that parse back to the same value
+  template <typename T>
+  void writeShortestFloat(T value) {
+    if (writeFloatSpecialValue(value))
+      return;
+
+    if (value == 0)
+      return writeRaw('0');
+
+    auto decimal = shortestDecimal(value);
+    const char* digits = decimal.digits;
+    int length = decimal.length;
+    int point = length + decimal.exponent;  // position of the decimal point
+
+    if (value >= ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD ||
+        value <= ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD) {
+      writeRaw(digits[0]);
+      if (length > 1) {
+        writeRaw('.');
+        writeRaw(digits + 1, digits + length);
+      }
+      writeRaw('e');
+      writeInteger(point - 1);
+    } else if (point <= 0) {
+      writeRaw("0.");
+      for (int i = point; i < 0; i++)
+        writeRaw('0');
+      writeRaw(digits, digits + length);
+    } else if (point < length) {
+      writeRaw(digits, digits + point);
+      writeRaw('.');
+      writeRaw(digits + point, digits + length);
+    } else {
+      writeRaw(digits, digits + length);
+      for (int i = length; i < point; i++)
+        writeRaw('0');
+    }
+  }
+
+  // Writes NaN and Infinity, or the minus sign of other values.
+  // Returns true if the value is fully written.
+  template <typename T>
+  bool writeFloatSpecialValue(T& value) {
+    if (isnan(value)) {
+      writeRaw(ARDUINOJSON_ENABLE_NAN ? "NaN" : "null");
+      return true;
+    }
 
 #if ARDUINOJSON_ENABLE_INFINITY
     if (value < 0.0) {
@@ -79,11 +144,15 @@ class TextFormatter {
       value = -value;
     }
 
-    if (isinf(value))
-      return writeRaw("Infinity");
+    if (isinf(value)) {
+      writeRaw("Infinity");
+      return true;
+    }
 #else
-    if (isinf(value))
-      return writeRaw("null");
+    if (isinf(value)) {
+      writeRaw("null");
+      return true;
+    }
 
     if (value < 0.0) {
       writeRaw('-');
@@ -91,16 +160,7 @@ class TextFormatter {
     }
 #endif
 
-    auto parts = decomposeFloat(value, decimalPlaces);
-
-    writeInteger(parts.integral);
-    if (parts.decimalPlaces)
-      writeDecimals(parts.decimal, parts.decimalPlaces);
-
-    if (parts.exponent) {
-      writeRaw('e');
-      writeInteger(parts.exponent);
-    }
+    return false;
   }
 
   template <typename T>
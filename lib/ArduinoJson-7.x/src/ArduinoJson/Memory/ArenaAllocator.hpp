@@ -0,0 +1,193 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Alignment.hpp>
+#include <ArduinoJson/Memory/Allocator.hpp>
+
+#include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// An allocator that carves the blocks out of a fixed buffer.
+// The memory is reclaimed all at once when the arena is rewound (see
+// ArenaScope); only the last block is reclaimed by deallocate().
+// When the buffer is full, the allocations go to the upstream allocator (the
+// heap by default), or fail if it's null.
+class ArenaAllocator : public Allocator {
+ public:
+  ArenaAllocator(void* buffer, size_t capacity,
+                 Allocator* upstream = detail::DefaultAllocator::instance())
+      : begin_(detail::addPadding(static_cast<char*>(buffer))),
+        capacity_(0),
+        size_(0),
+        peak_(0),
+        last_(noBlock),
+        overflows_(0),
+        upstream_(upstream) {
+    size_t padding = size_t(begin_ - static_cast<char*>(buffer));
+    if (capacity > padding)
+      capacity_ = capacity - padding;
+  }
+
+  virtual ~ArenaAllocator() = default;
+
+  void* allocate(size_t size) override {
+    size_t blockSize = detail::addPadding(headerSize + size);
+    if (blockSize > capacity_ - size_) {
+      overflows_++;
+      return upstream_ ? upstream_->allocate(size) : nullptr;
+    }
+
+    auto header = reinterpret_cast<Header*>(begin_ + size_);
+    header->size = size;
+    last_ = size_;
+    size_ += blockSize;
+    if (size_ > peak_)
+      peak_ = size_;
+    return payloadOf(header);
+  }
+
+  void deallocate(void* ptr) override {
+    if (!contains(ptr)) {
+      if (ptr)
+        upstream_->deallocate(ptr);
+      return;
+    }
+
+    if (offsetOf(ptr) == last_) {
+      size_ = last_;
+      last_ = noBlock;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t new_size) override {
+    if (!ptr)
+      return allocate(new_size);
+
+    if (!contains(ptr))
+      return upstream_->reallocate(ptr, new_size);
+
+    auto header = headerOf(ptr);
+    size_t offset = offsetOf(ptr);
+
+    // The last block can grow or shrink in place
+    if (offset == last_) {
+      size_t blockSize = detail::addPadding(headerSize + new_size);
+      if (blockSize <= capacity_ - offset) {
+        header->size = new_size;
+        size_ = offset + blockSize;
+        if (size_ > peak_)
+          peak_ = size_;
+        return ptr;
+      }
+    }
+
+    // Other blocks can only shrink in place
+    else if (new_size <= header->size) {
+      header->size = new_size;
+      return ptr;
+    }
+
+    void* newPtr = allocate(new_size);
+    if (!newPtr)
+      return nullptr;
+    memcpy(newPtr, ptr, header->size < new_size ? header->size : new_size);
+    deallocate(ptr);
+    return newPtr;
+  }
+
+  // Returns the number of bytes in use, including the headers of the blocks
+  size_t size() const {
+    return size_;
+  }
+
+  // Returns the usable size of the buffer
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  // Returns the highest value of size()
+  size_t peak() const {
+    return peak_;
+  }
+
+  // Returns the number of allocations that didn't fit in the buffer
+  size_t overflows() const {
+    return overflows_;
+  }
+
+  // Releases the blocks allocated since size() was equal to the given value
+  void rewind(size_t size) {
+    if (size >= size_)
+      return;
+    size_ = size;
+    if (last_ >= size)
+      last_ = noBlock;
+  }
+
+  // Releases all the blocks
+  void reset() {
+    rewind(0);
+  }
+
+ private:
+  struct Header {
+    size_t size;
+  };
+
+  static const size_t headerSize = detail::AddPadding<sizeof(Header)>::value;
+  static const size_t noBlock = size_t(-1);
+
+  bool contains(void* ptr) const {
+    char* p = static_cast<char*>(ptr);
+    return p >= begin_ && p < begin_ + capacity_;
+  }
+
+  size_t offsetOf(void* ptr) const {
+    return size_t(static_cast<char*>(ptr) - begin_) - headerSize;
+  }
+
+  static Header* headerOf(void* ptr) {
+    // Cast to void* to silence "cast increases required alignment"
+    return reinterpret_cast<Header*>(
+        static_cast<void*>(static_cast<char*>(ptr) - headerSize));
+  }
+
+  static void* payloadOf(Header* header) {
+    return reinterpret_cast<char*>(header) + headerSize;
+  }
+
+  char* begin_;
+  size_t capacity_;
+  size_t size_;
+  size_t peak_;
+  size_t last_;  // offset of the last block, if it's still allocated
+  size_t overflows_;
+  Allocator* upstream_;
+};
+
+// Rewinds an ArenaAllocator when leaving the scope, releasing all the blocks
+// allocated in between.
+// The documents using the arena must be destroyed first, so declare the scope
+// before them.
+class ArenaScope {
+ public:
+  explicit ArenaScope(ArenaAllocator& arena)
+      : arena_(arena), mark_(arena.size()) {}
+
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+  ~ArenaScope() {
+    arena_.rewind(mark_);
+  }
+
+ private:
+  ArenaAllocator& arena_;
+  size_t mark_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -0,0 +1,101 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/StringBuilder.hpp>
+
+#include <string.h>  // memchr, memmove
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A StringBuilder that writes the string over the input it was read from, so
+// that the variant can link to it instead of owning a copy.
+// The decoded string is never longer than the source, so the writing never
+// overtakes the reading.
+// Strings that don't start with startString(char*), such as unquoted keys,
+// are copied to the pool, which is only allocated if needed.
+class InPlaceStringBuilder {
+ public:
+  InPlaceStringBuilder(ResourceManager* resources) : copy_(resources) {}
+
+  // Starts a string that is copied to the pool
+  void startString() {
+    begin_ = nullptr;
+    copying_ = false;
+  }
+
+  // Starts a string that is written at the given address
+  void startString(char* dest) {
+    begin_ = end_ = dest;
+  }
+
+  void append(char c) {
+    if (begin_)
+      *end_++ = c;
+    else
+      copy().append(c);
+  }
+
+  void append(const char* s, size_t n) {
+    if (!begin_) {
+      copy().append(s, n);
+      return;
+    }
+    if (s != end_)  // there was an escape sequence before
+      memmove(end_, s, n);
+    end_ += n;
+  }
+
+  bool isValid() {
+    return begin_ || copy().isValid();
+  }
+
+  size_t size() {
+    return begin_ ? size_t(end_ - begin_) : copy().size();
+  }
+
+  // Writes the terminator, which must not overwrite unread input
+  JsonString str() {
+    if (!begin_)
+      return copy().str();
+    *end_ = 0;
+    return JsonString(begin_, size());
+  }
+
+  void save(VariantData* variant) {
+    if (!begin_) {
+      copy().save(variant);
+      return;
+    }
+
+    *end_ = 0;
+    const char* s = begin_;
+    size_t n = size();
+    if (memchr(s, 0, n)) {
+      // A linked string can't contain a null char, so copy it to the pool
+      startString();
+      copy().append(s, n);
+      copy().save(variant);
+    } else {
+      variant->setLinkedString(s);
+    }
+  }
+
+ private:
+  StringBuilder& copy() {
+    if (!copying_) {
+      copy_.startString();
+      copying_ = true;
+    }
+    return copy_;
+  }
+
+  StringBuilder copy_;
+  bool copying_ = false;
+  char* begin_ = nullptr;
+  char* end_ = nullptr;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -137,6 +137,82 @@ class MemoryPoolList {
     return Pool::slotsToBytes(usage());
   }
 
+  SlotCount capacity() const {
+    SlotCount total = 0;
+    for (PoolCount i = 0; i < count_; i++)
+      total = SlotCount(total + pools_[i].capacity());
+    return total;
+  }
+
+  // The number of slots in the free list
+  SlotCount freeCount() const {
+    SlotCount count = 0;
+    for (auto id = freeList_; id != NULL_SLOT; id = nextFreeSlot(id))
+      count++;
+    return count;
+  }
+
+  // The memory of the pools, and of the pool list if it's not preallocated
+  size_t allocatedBytes() const {
+    size_t total = Pool::slotsToBytes(capacity());
+    if (pools_ != preallocatedPools_)
+      total += capacity_ * sizeof(Pool);
+    return total;
+  }
+
+  // The compaction moves the slots that are above the limit into the free
+  // slots below it, so that the pools can be truncated at the limit.
+  // The caller must relocate every slot in use, then call endCompaction().
+  // Returns NULL_SLOT, which moves nothing, if a pool failed to allocate.
+  SlotId beginCompaction() {
+    for (PoolCount i = 0; i + 1 < count_; i++)
+      if (pools_[i].usage() != ARDUINOJSON_POOL_CAPACITY)
+        return NULL_SLOT;
+
+    auto limit = SlotId(usage() - freeCount());
+
+    // keep only the free slots below the limit
+    SlotId id = freeList_;
+    freeList_ = NULL_SLOT;
+    while (id != NULL_SLOT) {
+      auto next = nextFreeSlot(id);
+      if (id < limit)
+        freeSlot({getSlot(id), id});
+      id = next;
+    }
+
+    return limit;
+  }
+
+  // Moves the slot below the limit, if needed, and returns its new id
+  SlotId relocateSlot(SlotId id, SlotId limit) {
+    if (id < limit)
+      return id;
+    auto slot = allocFromFreeList();
+    memcpy(slot.ptr(), getSlot(id), sizeof(T));
+    return slot.id();
+  }
+
+  void endCompaction(SlotId limit, Allocator* allocator) {
+    if (limit == NULL_SLOT) {
+      shrinkToFit(allocator);
+      return;
+    }
+    ARDUINOJSON_ASSERT(freeList_ == NULL_SLOT);  // all slots were relocated
+    if (limit == 0) {
+      clear(allocator);
+      return;
+    }
+    auto newCount = PoolCount((limit + ARDUINOJSON_POOL_CAPACITY - 1) /
+                              ARDUINOJSON_POOL_CAPACITY);
+    for (PoolCount i = newCount; i < count_; i++)
+      pools_[i].destroy(allocator);
+    count_ = newCount;
+    pools_[count_ - 1].truncate(
+        SlotCount(limit - (count_ - 1) * ARDUINOJSON_POOL_CAPACITY));
+    shrinkToFit(allocator);
+  }
+
   void shrinkToFit(Allocator* allocator) {
     if (count_ > 0)
       pools_[count_ - 1].shrinkToFit(allocator);
@@ -149,6 +225,10 @@ class MemoryPoolList {
   }
 
  private:
+  SlotId nextFreeSlot(SlotId id) const {
+    return reinterpret_cast<FreeSlot*>(getSlot(id))->next;
+  }
+
   Slot<T> allocFromFreeList() {
     ARDUINOJSON_ASSERT(freeList_ != NULL_SLOT);
     auto id = freeList_;
@@ -0,0 +1,58 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+#include <stddef.h>  // offsetof
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Open addressing hash table of the keys of an object.
+// The table stores the slot id of each key, so it stays valid when the
+// variant pools grow; it's allocated next to the pools, not inside them.
+struct ObjectIndex {
+  ObjectIndex* next;
+  const void* object;
+  SlotId lastKey;   // keys appended after this one are not in the table yet
+  size_t count;     // keys in the table
+  size_t capacity;  // a power of two
+  SlotId keys[1];
+
+  static constexpr size_t sizeForCapacity(size_t n) {
+    return offsetof(ObjectIndex, keys) + n * sizeof(SlotId);
+  }
+
+  static ObjectIndex* create(const void* object, size_t capacity,
+                             Allocator* allocator) {
+    ARDUINOJSON_ASSERT((capacity & (capacity - 1)) == 0);
+    auto index = reinterpret_cast<ObjectIndex*>(
+        allocator->allocate(sizeForCapacity(capacity)));
+    if (index) {
+      index->next = nullptr;
+      index->object = object;
+      index->lastKey = NULL_SLOT;
+      index->count = 0;
+      index->capacity = capacity;
+      for (size_t i = 0; i < capacity; i++)
+        index->keys[i] = NULL_SLOT;
+    }
+    return index;
+  }
+
+  static void destroy(ObjectIndex* index, Allocator* allocator) {
+    allocator->deallocate(index);
+  }
+};
+
+// Returns the size (in bytes) of an object index with n entries.
+constexpr size_t sizeofObjectIndex(size_t n) {
+  return ObjectIndex::sizeForCapacity(n);
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -6,6 +6,7 @@
 
 #include <ArduinoJson/Memory/Allocator.hpp>
 #include <ArduinoJson/Memory/MemoryPoolList.hpp>
+#include <ArduinoJson/Memory/ObjectIndex.hpp>
 #include <ArduinoJson/Memory/StringPool.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/utility.hpp>
@@ -29,9 +30,12 @@ class ResourceManager {
   constexpr static size_t slotSize = sizeof(SlotData);
 
   ResourceManager(Allocator* allocator = DefaultAllocator::instance())
-      : allocator_(allocator), overflowed_(false) {}
+      : allocator_(allocator), overflowed_(false), peak_(0) {}
 
   ~ResourceManager() {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+    clearObjectIndexes();
+#endif
     stringPool_.clear(allocator_);
     variantPools_.clear(allocator_);
   }
@@ -40,10 +44,17 @@ class ResourceManager {
   ResourceManager& operator=(const ResourceManager& src) = delete;
 
   friend void swap(ResourceManager& a, ResourceManager& b) {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+    // the indexes refer to objects by address, and the documents swap their
+    // root objects by value
+    a.clearObjectIndexes();
+    b.clearObjectIndexes();
+#endif
     swap(a.stringPool_, b.stringPool_);
     swap(a.variantPools_, b.variantPools_);
     swap_(a.allocator_, b.allocator_);
     swap_(a.overflowed_, b.overflowed_);
+    swap_(a.peak_, b.peak_);
   }
 
   Allocator* allocator() const {
@@ -58,6 +69,28 @@ class ResourceManager {
     return overflowed_;
   }
 
+  // The memory of the slots and strings, including the unused slots
+  size_t allocatedBytes() const {
+    return variantPools_.allocatedBytes() + stringPool_.size();
+  }
+
+  // The highest value of allocatedBytes() since the creation
+  size_t peak() const {
+    return peak_;
+  }
+
+  SlotCount slotsUsed() const {
+    return SlotCount(variantPools_.usage() - variantPools_.freeCount());
+  }
+
+  SlotCount slotsAllocated() const {
+    return variantPools_.capacity();
+  }
+
+  const StringPool& strings() const {
+    return stringPool_;
+  }
+
   Slot<VariantData> allocVariant();
   void freeVariant(Slot<VariantData> slot);
   VariantData* getVariant(SlotId id) const;
@@ -74,7 +107,9 @@ class ResourceManager {
       return 0;
 
     auto node = stringPool_.add(str, allocator_);
-    if (!node)
+    if (node)
+      updatePeak();
+    else
       overflowed_ = true;
 
     return node;
@@ -82,6 +117,7 @@ class ResourceManager {
 
   void saveString(StringNode* node) {
     stringPool_.add(node);
+    updatePeak();
   }
 
   template <typename TAdaptedString>
@@ -112,20 +148,97 @@ class ResourceManager {
   }
 
   void clear() {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+    clearObjectIndexes();
+#endif
     variantPools_.clear(allocator_);
     overflowed_ = false;
     stringPool_.clear(allocator_);
   }
 
   void shrinkToFit() {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+    // the last pool may move
+    clearObjectIndexes();
+#endif
     variantPools_.shrinkToFit(allocator_);
   }
 
+  // Moves the slots of root, and of its descendants, into the free slots
+  // left by removals, then releases the unused memory.
+  void compact(VariantData* root);
+
+  // For compact(): moves the slot into a free slot below the limit
+  SlotId relocateSlot(SlotId id, SlotId limit) {
+    return variantPools_.relocateSlot(id, limit);
+  }
+
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  // The indexes are a cache: lookups work without them, so they are managed
+  // through const methods and failing to allocate one is not an overflow.
+
+  ObjectIndex* getObjectIndex(const void* object) const {
+    ObjectIndex* prev = nullptr;
+    for (auto index = objectIndexes_; index; index = index->next) {
+      if (index->object == object) {
+        if (prev) {  // move to front, lookups tend to hit the same object
+          prev->next = index->next;
+          index->next = objectIndexes_;
+          objectIndexes_ = index;
+        }
+        return index;
+      }
+      prev = index;
+    }
+    return nullptr;
+  }
+
+  ObjectIndex* createObjectIndex(const void* object, size_t capacity) const {
+    auto index = ObjectIndex::create(object, capacity, allocator_);
+    if (index) {
+      index->next = objectIndexes_;
+      objectIndexes_ = index;
+    }
+    return index;
+  }
+
+  void dropObjectIndex(const void* object) const {
+    ObjectIndex** prev = &objectIndexes_;
+    while (*prev) {
+      auto index = *prev;
+      if (index->object == object) {
+        *prev = index->next;
+        ObjectIndex::destroy(index, allocator_);
+        return;
+      }
+      prev = &index->next;
+    }
+  }
+
+  void clearObjectIndexes() const {
+    while (objectIndexes_) {
+      auto index = objectIndexes_;
+      objectIndexes_ = index->next;
+      ObjectIndex::destroy(index, allocator_);
+    }
+  }
+#endif
+
  private:
+  void updatePeak() {
+    auto size = allocatedBytes();
+    if (size > peak_)
+      peak_ = size;
+  }
+
   Allocator* allocator_;
   bool overflowed_;
+  size_t peak_;
   StringPool stringPool_;
   MemoryPoolList<SlotData> variantPools_;
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  mutable ObjectIndex* objectIndexes_ = nullptr;
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
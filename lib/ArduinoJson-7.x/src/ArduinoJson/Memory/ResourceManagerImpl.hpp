@@ -17,6 +17,8 @@ inline Slot<VariantData> ResourceManager::allocVariant() {
     overflowed_ = true;
     return {};
   }
+  if (p.id() % ARDUINOJSON_POOL_CAPACITY == 0)  // maybe a new pool
+    updatePeak();
   return {new (&p->variant) VariantData, p.id()};
 }
 
@@ -29,6 +31,16 @@ inline VariantData* ResourceManager::getVariant(SlotId id) const {
   return reinterpret_cast<VariantData*>(variantPools_.getSlot(id));
 }
 
+inline void ResourceManager::compact(VariantData* root) {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  // the objects move
+  clearObjectIndexes();
+#endif
+  auto limit = variantPools_.beginCompaction();
+  root->relocateSlots(limit, this);
+  variantPools_.endCompaction(limit, allocator_);
+}
+
 #if ARDUINOJSON_USE_EXTENSIONS
 inline Slot<VariantExtension> ResourceManager::allocExtension() {
   auto p = variantPools_.allocSlot(allocator_);
@@ -36,6 +48,8 @@ inline Slot<VariantExtension> ResourceManager::allocExtension() {
     overflowed_ = true;
     return {};
   }
+  if (p.id() % ARDUINOJSON_POOL_CAPACITY == 0)  // maybe a new pool
+    updatePeak();
   return {&p->extension, p.id()};
 }
 
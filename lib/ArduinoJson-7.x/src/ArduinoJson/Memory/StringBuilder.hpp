@@ -6,6 +6,8 @@
 
 #include <ArduinoJson/Memory/ResourceManager.hpp>
 
+#include <string.h>  // memcpy
+
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
 class StringBuilder {
@@ -54,8 +56,20 @@ class StringBuilder {
   }
 
   void append(const char* s, size_t n) {
-    while (n-- > 0)  // TODO: memcpy
-      append(*s++);
+    // same growth as append(char), but copies as much as possible at once
+    while (n > 0 && node_) {
+      if (size_ == node_->length) {
+        node_ = resources_->resizeString(node_, size_ * 2U + 1);
+        if (!node_)
+          break;
+      }
+      size_t room = node_->length - size_;
+      size_t count = n < room ? n : room;
+      memcpy(node_->data + size_, s, count);
+      size_ += count;
+      s += count;
+      n -= count;
+    }
   }
 
   void append(char c) {
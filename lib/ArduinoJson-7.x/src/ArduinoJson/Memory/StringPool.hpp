@@ -24,6 +24,7 @@ class StringPool {
 
   friend void swap(StringPool& a, StringPool& b) {
     swap_(a.strings_, b.strings_);
+    swap_(a.size_, b.size_);
   }
 
   void clear(Allocator* allocator) {
@@ -32,12 +33,26 @@ class StringPool {
       strings_ = node->next;
       StringNode::destroy(node, allocator);
     }
+    size_ = 0;
   }
 
   size_t size() const {
+    return size_;
+  }
+
+  // The number of distinct strings
+  size_t count() const {
+    size_t total = 0;
+    for (auto node = strings_; node; node = node->next)
+      total++;
+    return total;
+  }
+
+  // The number of times the strings are used; above count(), they're shared
+  size_t references() const {
     size_t total = 0;
     for (auto node = strings_; node; node = node->next)
-      total += sizeofString(node->length);
+      total += node->references;
     return total;
   }
 
@@ -67,6 +82,7 @@ class StringPool {
     ARDUINOJSON_ASSERT(node != nullptr);
     node->next = strings_;
     strings_ = node;
+    size_ += sizeofString(node->length);
   }
 
   template <typename TAdaptedString>
@@ -87,6 +103,7 @@ class StringPool {
             prev->next = node->next;
           else
             strings_ = node->next;
+          size_ -= sizeofString(node->length);
           StringNode::destroy(node, allocator);
         }
         return;
@@ -97,6 +114,7 @@ class StringPool {
 
  private:
   StringNode* strings_ = nullptr;
+  size_t size_ = 0;  // the sum of sizeofString() for all strings
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -7,6 +7,7 @@
 #include <ArduinoJson/Numbers/FloatTraits.hpp>
 #include <ArduinoJson/Numbers/JsonFloat.hpp>
 #include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Numbers/decimalToFloat.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/ctype.hpp>
 #include <ArduinoJson/Polyfills/math.hpp>
@@ -138,6 +139,12 @@ inline Number parseNumber(const char* s) {
   mantissa_t mantissa = 0;
   exponent_t exponent_offset = 0;
   const mantissa_t maxUint = JsonUInt(-1);
+#if ARDUINOJSON_FAST_FLOAT_PARSING
+  // keep 19 digits for decimalToFloat()
+  const uint64_t mantissa_max = 9999999999999999999U;
+#else
+  const mantissa_t mantissa_max = traits::mantissa_max;
+#endif
 
   while (isdigit(*s)) {
     uint8_t digit = uint8_t(*s - '0');
@@ -163,7 +170,7 @@ inline Number parseNumber(const char* s) {
   }
 
   // avoid mantissa overflow
-  while (mantissa > traits::mantissa_max) {
+  while (mantissa > mantissa_max) {
     mantissa /= 10;
     exponent_offset++;
   }
@@ -177,7 +184,7 @@ inline Number parseNumber(const char* s) {
   if (*s == '.') {
     s++;
     while (isdigit(*s)) {
-      if (mantissa < traits::mantissa_max / 10) {
+      if (mantissa < mantissa_max / 10) {
         mantissa = mantissa * 10 + uint8_t(*s - '0');
         exponent_offset--;
       }
@@ -196,9 +203,18 @@ inline Number parseNumber(const char* s) {
       s++;
     }
 
+#if ARDUINOJSON_FAST_FLOAT_PARSING
+    // decimalToFloat() supports the subnormals
+    const int exponent_limit =
+        negative_exponent ? -DecimalToFloatTraits<JsonFloat>::minDecimalExponent
+                          : traits::exponent_max;
+#else
+    const int exponent_limit = traits::exponent_max;
+#endif
+
     while (isdigit(*s)) {
       exponent = exponent * 10 + (*s - '0');
-      if (exponent + exponent_offset > traits::exponent_max) {
+      if (exponent + exponent_offset > exponent_limit) {
         if (negative_exponent)
           return Number(is_negative ? -0.0f : 0.0f);
         else
@@ -219,6 +235,30 @@ inline Number parseNumber(const char* s) {
   bool isDouble = exponent < -FloatTraits<float>::exponent_max ||
                   exponent > FloatTraits<float>::exponent_max ||
                   mantissa > FloatTraits<float>::mantissa_max;
+#endif
+
+#if ARDUINOJSON_FAST_FLOAT_PARSING
+#  if ARDUINOJSON_USE_DOUBLE
+  if (isDouble) {
+    double result;
+    if (decimalToFloat(mantissa, exponent, result))
+      return Number(is_negative ? -result : result);
+  } else
+#  endif
+  {
+    float result;
+    if (decimalToFloat(mantissa, exponent, result))
+      return Number(is_negative ? -result : result);
+  }
+
+  // make_float() requires a smaller mantissa
+  while (mantissa > traits::mantissa_max) {
+    mantissa /= 10;
+    exponent++;
+  }
+#endif
+
+#if ARDUINOJSON_USE_DOUBLE
   if (isDouble) {
     auto final_result = make_float(double(mantissa), exponent);
     return Number(is_negative ? -final_result : final_result);
@@ -0,0 +1,252 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/decimalToFloat.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Finds a short decimal that converts back to the same float or double, using
+// the Grisu2 algorithm.
+// The result always round-trips because Grisu2 only picks digits strictly
+// inside the rounding interval of the value. In rare cases (about 0.1% of
+// doubles), the digits are not the shortest possible, but they are never more
+// than 17 (or 9 for float).
+// See Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+// with Integers" (2010).
+
+// value = digits * 10^exponent
+struct ShortestDecimal {
+  char digits[17];
+  uint8_t length;
+  int16_t exponent;
+};
+
+// value = f * 2^e
+struct DiyFp {
+  uint64_t f;
+  int e;
+};
+
+// The upper 64 bits of the product, rounded
+inline DiyFp multiply(DiyFp x, DiyFp y) {
+  Uint128 p = multiply(x.f, y.f);
+  return {p.high + (p.low >> 63), x.e + y.e + 64};
+}
+
+inline DiyFp normalized(DiyFp x) {
+  int shift = countLeadingZeros(x.f);
+  return {x.f << shift, x.e - shift};
+}
+
+// Grisu2 needs the cached power to bring the exponent between these
+const int grisuAlpha = -60;
+const int grisuGamma = -32;
+
+// The powers 10^k, for k from -300 to 324 by steps of 8, normalized to 64 bits
+inline DiyFp getCachedPower(int e, int& k) {
+  ARDUINOJSON_DEFINE_PROGMEM_ARRAY(  //
+      uint64_t, factors,
+      {
+          0xAB70FE17C79AC6CA,  // 1e-300
+          0xFF77B1FCBEBCDC4F,  // 1e-292
+          0xBE5691EF416BD60C,  // 1e-284
+          0x8DD01FAD907FFC3C,  // 1e-276
+          0xD3515C2831559A83,  // 1e-268
+          0x9D71AC8FADA6C9B5,  // 1e-260
+          0xEA9C227723EE8BCB,  // 1e-252
+          0xAECC49914078536D,  // 1e-244
+          0x823C12795DB6CE57,  // 1e-236
+          0xC21094364DFB5637,  // 1e-228
+          0x9096EA6F3848984F,  // 1e-220
+          0xD77485CB25823AC7,  // 1e-212
+          0xA086CFCD97BF97F4,  // 1e-204
+          0xEF340A98172AACE5,  // 1e-196
+          0xB23867FB2A35B28E,  // 1e-188
+          0x84C8D4DFD2C63F3B,  // 1e-180
+          0xC5DD44271AD3CDBA,  // 1e-172
+          0x936B9FCEBB25C996,  // 1e-164
+          0xDBAC6C247D62A584,  // 1e-156
+          0xA3AB66580D5FDAF6,  // 1e-148
+          0xF3E2F893DEC3F126,  // 1e-140
+          0xB5B5ADA8AAFF80B8,  // 1e-132
+          0x87625F056C7C4A8B,  // 1e-124
+          0xC9BCFF6034C13053,  // 1e-116
+          0x964E858C91BA2655,  // 1e-108
+          0xDFF9772470297EBD,  // 1e-100
+          0xA6DFBD9FB8E5B88F,  // 1e-92
+          0xF8A95FCF88747D94,  // 1e-84
+          0xB94470938FA89BCF,  // 1e-76
+          0x8A08F0F8BF0F156B,  // 1e-68
+          0xCDB02555653131B6,  // 1e-60
+          0x993FE2C6D07B7FAC,  // 1e-52
+          0xE45C10C42A2B3B06,  // 1e-44
+          0xAA242499697392D3,  // 1e-36
+          0xFD87B5F28300CA0E,  // 1e-28
+          0xBCE5086492111AEB,  // 1e-20
+          0x8CBCCC096F5088CC,  // 1e-12
+          0xD1B71758E219652C,  // 1e-4
+          0x9C40000000000000,  // 1e4
+          0xE8D4A51000000000,  // 1e12
+          0xAD78EBC5AC620000,  // 1e20
+          0x813F3978F8940984,  // 1e28
+          0xC097CE7BC90715B3,  // 1e36
+          0x8F7E32CE7BEA5C70,  // 1e44
+          0xD5D238A4ABE98068,  // 1e52
+          0x9F4F2726179A2245,  // 1e60
+          0xED63A231D4C4FB27,  // 1e68
+          0xB0DE65388CC8ADA8,  // 1e76
+          0x83C7088E1AAB65DB,  // 1e84
+          0xC45D1DF942711D9A,  // 1e92
+          0x924D692CA61BE758,  // 1e100
+          0xDA01EE641A708DEA,  // 1e108
+          0xA26DA3999AEF774A,  // 1e116
+          0xF209787BB47D6B85,  // 1e124
+          0xB454E4A179DD1877,  // 1e132
+          0x865B86925B9BC5C2,  // 1e140
+          0xC83553C5C8965D3D,  // 1e148
+          0x952AB45CFA97A0B3,  // 1e156
+          0xDE469FBD99A05FE3,  // 1e164
+          0xA59BC234DB398C25,  // 1e172
+          0xF6C69A72A3989F5C,  // 1e180
+          0xB7DCBF5354E9BECE,  // 1e188
+          0x88FCF317F22241E2,  // 1e196
+          0xCC20CE9BD35C78A5,  // 1e204
+          0x98165AF37B2153DF,  // 1e212
+          0xE2A0B5DC971F303A,  // 1e220
+          0xA8D9D1535CE3B396,  // 1e228
+          0xFB9B7CD9A4A7443C,  // 1e236
+          0xBB764C4CA7A44410,  // 1e244
+          0x8BAB8EEFB6409C1A,  // 1e252
+          0xD01FEF10A657842C,  // 1e260
+          0x9B10A4E5E9913129,  // 1e268
+          0xE7109BFBA19C0C9D,  // 1e276
+          0xAC2820D9623BF429,  // 1e284
+          0x80444B5E7AA7CF85,  // 1e292
+          0xBF21E44003ACDD2D,  // 1e300
+          0x8E679C2F5E44FF8F,  // 1e308
+          0xD433179D9C8CB841,  // 1e316
+          0x9E19DB92B4E31BA9,  // 1e324
+      });
+  const int32_t minK = -300;
+  const int32_t stepK = 8;
+
+  // the smallest k such that e + 64 + log2(10^k) >= alpha, i.e.
+  // k = ceil((alpha - e - 1) * log10(2))
+  int32_t f = grisuAlpha - e - 1;
+  int32_t ceilK = f * 78913 / (int32_t(1) << 18) + (f > 0);
+  int32_t index = (ceilK - minK + stepK - 1) / stepK;
+  k = int(minK + index * stepK);
+
+  // e = floor(k * log2(10)) - 63, with a positive dividend for the shift
+  int binaryExponent =
+      int((int32_t(k) * 1741647 + (int32_t(1) << 30)) >> 19) - (1 << 11) - 63;
+  ARDUINOJSON_ASSERT(e + binaryExponent + 64 >= grisuAlpha);
+  ARDUINOJSON_ASSERT(e + binaryExponent + 64 <= grisuGamma);
+  return {pgm_ptr<uint64_t>(factors)[index], binaryExponent};
+}
+
+// Moves the last digit closer to the value, as long as it stays in the interval
+inline void grisuRound(ShortestDecimal& result, uint64_t dist, uint64_t delta,
+                       uint64_t rest, uint64_t tenK) {
+  while (rest < dist && delta - rest >= tenK &&
+         (rest + tenK < dist || dist - rest > rest + tenK - dist)) {
+    result.digits[result.length - 1]--;
+    rest += tenK;
+  }
+}
+
+// Generates the digits of upper, until they are inside (lower, upper)
+inline void grisuDigits(ShortestDecimal& result, DiyFp lower, DiyFp value,
+                        DiyFp upper) {
+  uint64_t delta = upper.f - lower.f;
+  uint64_t dist = upper.f - value.f;
+
+  // upper = p1 + p2 * 2^e
+  int shift = -upper.e;
+  uint64_t one = uint64_t(1) << shift;
+  uint32_t p1 = uint32_t(upper.f >> shift);
+  uint64_t p2 = upper.f & (one - 1);
+
+  // the integral part, whose digits are found backwards, as divisions by a
+  // constant are much cheaper
+  char integralDigits[10];
+  int n = 0;
+  uint32_t pow10 = 1;
+  for (uint32_t x = p1; x; x /= 10) {
+    integralDigits[n++] = char('0' + x % 10);
+    if (x >= 10)
+      pow10 *= 10;
+  }
+  while (n > 0) {
+    char digit = integralDigits[--n];
+    result.digits[result.length++] = digit;
+    p1 -= uint32_t(digit - '0') * pow10;
+    uint64_t rest = (uint64_t(p1) << shift) + p2;
+    if (rest <= delta) {
+      result.exponent = int16_t(result.exponent + n);
+      grisuRound(result, dist, delta, rest, uint64_t(pow10) << shift);
+      return;
+    }
+    pow10 /= 10;
+  }
+
+  // the fractional part
+  for (;;) {
+    p2 *= 10;
+    result.digits[result.length++] = char('0' + (p2 >> shift));
+    p2 &= one - 1;
+    result.exponent--;
+    delta *= 10;
+    dist *= 10;
+    if (p2 <= delta)
+      break;
+  }
+  grisuRound(result, dist, delta, p2, one);
+}
+
+// Requires a finite value greater than zero
+template <typename T>
+inline ShortestDecimal shortestDecimal(T value) {
+  using traits = DecimalToFloatTraits<T>;
+  using bits_type = typename traits::bits_type;
+  const int bias = traits::mantissaBits - traits::minimumExponent;
+  const uint64_t hiddenBit = uint64_t(1) << traits::mantissaBits;
+
+  bits_type bits = alias_cast<bits_type>(value);
+  uint64_t mantissa = bits & (hiddenBit - 1);
+  int exponent = int(bits >> traits::mantissaBits);
+
+  DiyFp v = exponent ? DiyFp{mantissa + hiddenBit, exponent - bias}
+                     : DiyFp{mantissa, 1 - bias};  // subnormal
+
+  // the boundaries of the rounding interval: halfway to the neighbors
+  DiyFp upper = normalized({2 * v.f + 1, v.e - 1});
+  DiyFp lower = mantissa == 0 && exponent > 1
+                    ? DiyFp{4 * v.f - 1, v.e - 2}  // the lower one is closer
+                    : DiyFp{2 * v.f - 1, v.e - 1};
+  lower.f <<= lower.e - upper.e;
+  lower.e = upper.e;
+
+  // scale by 10^-k to get an exponent between alpha and gamma
+  int k;
+  DiyFp cachedPower = getCachedPower(upper.e, k);
+  DiyFp w = multiply(normalized(v), cachedPower);
+  DiyFp wLower = multiply(lower, cachedPower);
+  DiyFp wUpper = multiply(upper, cachedPower);
+
+  // exclude the boundaries, as they might be off by one unit
+  wLower.f++;
+  wUpper.f--;
+
+  ShortestDecimal result;
+  result.length = 0;
+  result.exponent = int16_t(-k);
+  grisuDigits(result, wLower, w, wUpper);
+  return result;
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Collection/CollectionData.hpp>
+#include <ArduinoJson/Memory/ObjectIndex.hpp>
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
@@ -65,6 +66,18 @@ class ObjectData : public CollectionData {
  private:
   template <typename TAdaptedString>
   iterator findKey(TAdaptedString key, const ResourceManager* resources) const;
+
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  template <typename TAdaptedString>
+  iterator findIndexedKey(const ObjectIndex* index, TAdaptedString key,
+                          const ResourceManager* resources) const;
+
+  ObjectIndex* buildIndex(const ResourceManager* resources) const;
+  ObjectIndex* updateIndex(ObjectIndex* index,
+                           const ResourceManager* resources) const;
+  void insertKey(ObjectIndex* index, SlotId keyId,
+                 const ResourceManager* resources) const;
+#endif
 };
 
 ARDUINOJSON_END_PRIVATE_NAMESPACE
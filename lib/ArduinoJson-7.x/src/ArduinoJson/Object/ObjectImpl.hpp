@@ -34,15 +34,105 @@ inline ObjectData::iterator ObjectData::findKey(
     TAdaptedString key, const ResourceManager* resources) const {
   if (key.isNull())
     return iterator();
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+  auto index = resources->getObjectIndex(this);
+  if (index)
+    index = updateIndex(index, resources);
+  if (index)
+    return findIndexedKey(index, key, resources);
+  size_t keys = 0;
+#endif
   bool isKey = true;
   for (auto it = createIterator(resources); !it.done(); it.next(resources)) {
-    if (isKey && stringEquals(key, adaptString(it->asString())))
-      return it;
+    if (isKey) {
+      if (stringEquals(key, adaptString(it->asString())))
+        return it;
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+      // large object => index it, and look up there instead of going on
+      if (++keys == ARDUINOJSON_OBJECT_INDEX_THRESHOLD) {
+        index = buildIndex(resources);
+        if (index)
+          return findIndexedKey(index, key, resources);
+      }
+#endif
+    }
     isKey = !isKey;
   }
   return iterator();
 }
 
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+template <typename TAdaptedString>
+inline ObjectData::iterator ObjectData::findIndexedKey(
+    const ObjectIndex* index, TAdaptedString key,
+    const ResourceManager* resources) const {
+  size_t mask = index->capacity - 1;
+  for (size_t i = stringHash(key) & mask; index->keys[i] != NULL_SLOT;
+       i = (i + 1) & mask) {
+    auto keyId = index->keys[i];
+    auto keySlot = resources->getVariant(keyId);
+    if (stringEquals(key, adaptString(keySlot->asString())))
+      return iteratorAt(keyId, resources);
+  }
+  return iterator();
+}
+
+// Creates an index of all the keys, with room for as many more
+inline ObjectIndex* ObjectData::buildIndex(
+    const ResourceManager* resources) const {
+  resources->dropObjectIndex(this);
+
+  size_t capacity = 8;
+  while (capacity < size(resources) * 4)
+    capacity *= 2;
+
+  auto index = resources->createObjectIndex(this, capacity);
+  if (!index)
+    return nullptr;
+
+  for (auto keyId = head(); keyId != NULL_SLOT;) {
+    auto valueId = resources->getVariant(keyId)->next();
+    insertKey(index, keyId, resources);
+    keyId = resources->getVariant(valueId)->next();
+  }
+  return index;
+}
+
+// Adds the keys appended since the index was last used
+inline ObjectIndex* ObjectData::updateIndex(
+    ObjectIndex* index, const ResourceManager* resources) const {
+  ARDUINOJSON_ASSERT(index->lastKey != NULL_SLOT);
+  auto valueId = resources->getVariant(index->lastKey)->next();
+  auto keyId = resources->getVariant(valueId)->next();
+  while (keyId != NULL_SLOT) {
+    valueId = resources->getVariant(keyId)->next();
+    if ((index->count + 1) * 2 > index->capacity)  // keep load factor <= 1/2
+      return buildIndex(resources);
+    insertKey(index, keyId, resources);
+    keyId = resources->getVariant(valueId)->next();
+  }
+  return index;
+}
+
+inline void ObjectData::insertKey(ObjectIndex* index, SlotId keyId,
+                                  const ResourceManager* resources) const {
+  auto key = adaptString(resources->getVariant(keyId)->asString());
+  index->lastKey = keyId;
+  if (key.isNull())  // the deserializer didn't save it (out of memory)
+    return;
+  size_t mask = index->capacity - 1;
+  size_t i = stringHash(key) & mask;
+  while (index->keys[i] != NULL_SLOT) {
+    auto other = resources->getVariant(index->keys[i]);
+    if (stringEquals(key, adaptString(other->asString())))
+      return;  // duplicate key, the first one wins like in a linear search
+    i = (i + 1) & mask;
+  }
+  index->keys[i] = keyId;
+  index->count++;
+}
+#endif
+
 template <typename TAdaptedString>
 inline void ObjectData::removeMember(TAdaptedString key,
                                      ResourceManager* resources) {
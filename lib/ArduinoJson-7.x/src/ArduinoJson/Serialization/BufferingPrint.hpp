@@ -0,0 +1,106 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+
+#if ARDUINOJSON_ENABLE_ARDUINO_PRINT
+
+#  include <Arduino.h>
+
+#  include <string.h>  // memcpy
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// A Print that forwards the bytes to another Print in blocks of N bytes.
+// The serializers write one character at a time, which is slow on a network
+// client (one packet per write); this sends a response in blocks, without
+// building it in a String first.
+// The remaining bytes are forwarded by flush(), which also flushes the target,
+// or by the destructor.
+template <size_t N>
+class BufferingPrint final : public ::Print {
+ public:
+  explicit BufferingPrint(::Print& target) : target_(target), size_(0) {}
+
+  BufferingPrint(const BufferingPrint&) = delete;
+  BufferingPrint& operator=(const BufferingPrint&) = delete;
+
+  ~BufferingPrint() {
+    forward();
+  }
+
+  using ::Print::write;
+
+  size_t write(uint8_t c) override {
+    if (size_ == N && !forward())
+      return 0;
+    buffer_[size_++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) override {
+    size_t written = 0;
+    while (written < n) {
+      if (size_ == N && !forward())
+        break;
+      size_t chunk = n - written < N - size_ ? n - written : N - size_;
+      memcpy(buffer_ + size_, s + written, chunk);
+      size_ += chunk;
+      written += chunk;
+    }
+    return written;
+  }
+
+  void flush() override {
+    forward();
+    target_.flush();
+  }
+
+ private:
+  // Returns false if the target refused some bytes
+  bool forward() {
+    if (size_ == 0)
+      return true;
+    size_t written = target_.write(buffer_, size_);
+    bool ok = written == size_;
+    size_ = 0;
+    return ok;
+  }
+
+  ::Print& target_;
+  uint8_t buffer_[N];
+  size_t size_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+template <size_t N>
+struct has_print_writer<BufferingPrint<N>> : true_type {};
+
+// BufferingPrint is final, so the calls through this writer are not virtual
+template <size_t N>
+class Writer<BufferingPrint<N>, void> {
+ public:
+  explicit Writer(BufferingPrint<N>& print) : print_(&print) {}
+
+  size_t write(uint8_t c) {
+    return print_->write(c);
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    return print_->write(s, n);
+  }
+
+ private:
+  BufferingPrint<N>* print_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+#endif
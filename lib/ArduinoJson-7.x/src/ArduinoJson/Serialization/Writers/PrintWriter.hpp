@@ -8,9 +8,14 @@
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+// Set for the Print classes that have their own Writer (see BufferingPrint)
+template <typename T>
+struct has_print_writer : false_type {};
+
 template <typename TDestination>
 class Writer<TDestination,
-             enable_if_t<is_base_of<::Print, TDestination>::value>> {
+             enable_if_t<is_base_of<::Print, TDestination>::value &&
+                         !has_print_writer<TDestination>::value>> {
  public:
   explicit Writer(::Print& print) : print_(&print) {}
 
@@ -0,0 +1,50 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+
+#include <stddef.h>  // size_t
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Writes a string in a char array, truncates if it doesn't fit
+class FixedStringBuilder {
+ public:
+  FixedStringBuilder(char* buffer, size_t capacity)
+      : begin_(buffer), p_(buffer), end_(buffer + capacity - 1) {
+    ARDUINOJSON_ASSERT(capacity > 0);
+  }
+
+  void append(char c) {
+    if (p_ < end_)
+      *p_++ = c;
+    else
+      truncated_ = true;
+  }
+
+  // Adds the terminator, returns the length
+  size_t finish() {
+    *p_ = 0;
+    return size_t(p_ - begin_);
+  }
+
+  bool truncated() const {
+    return truncated_;
+  }
+
+  bool isValid() const {
+    return true;
+  }
+
+ private:
+  char* begin_;
+  char* p_;
+  char* end_;
+  bool truncated_ = false;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
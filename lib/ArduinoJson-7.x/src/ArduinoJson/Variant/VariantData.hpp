@@ -599,6 +599,10 @@ class VariantData {
   // Release the resources used by this variant and set it to null.
   void clear(ResourceManager* resources);
 
+  // Moves the slots of the descendants below the limit (see
+  // ResourceManager::compact())
+  void relocateSlots(SlotId limit, ResourceManager* resources);
+
   static void clear(VariantData* var, ResourceManager* resources) {
     if (!var)
       return;
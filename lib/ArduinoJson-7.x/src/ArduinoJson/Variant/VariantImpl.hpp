@@ -61,6 +61,18 @@ inline void VariantData::clear(ResourceManager* resources) {
   type_ = VariantType::Null;
 }
 
+inline void VariantData::relocateSlots(SlotId limit,
+                                       ResourceManager* resources) {
+#if ARDUINOJSON_USE_EXTENSIONS
+  if (type_ & VariantTypeBits::ExtensionBit)
+    content_.asSlotId = resources->relocateSlot(content_.asSlotId, limit);
+#endif
+
+  auto collection = asCollection();
+  if (collection)
+    collection->relocateSlots(limit, resources);
+}
+
 #if ARDUINOJSON_USE_EXTENSIONS
 inline const VariantExtension* VariantData::getExtension(
     const ResourceManager* resources) const {
@@ -245,6 +245,56 @@ void TFT_eSPI::loadMetrics(void)
   gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
 
   gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2/7;  // Guess at space width
+
+  buildUnicodeIndex();
+}
+
+
+/***************************************************************************************
+** Function name:           buildUnicodeIndex
+** Description:             Build the code point to glyph number lookup index
+*************************************************************************************x*/
+// The first 0x80 entries map ASCII codes directly to a glyph number. The remaining
+// glyph numbers are sorted by code point for a binary search. If there is not enough
+// memory getUnicodeIndex() falls back to a linear search of gUnicode[].
+#define VLW_NO_GLYPH 0xFFFF
+void TFT_eSPI::buildUnicodeIndex(void)
+{
+  uint32_t bytes = (0x80 + gFont.gCount) * 2;
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() ) gLookup = (uint16_t*)ps_malloc( bytes );
+  else
+#endif
+  gLookup = (uint16_t*)malloc( bytes );
+
+  if (gLookup == NULL) return;
+
+  for (uint16_t i = 0; i < 0x80; i++) gLookup[i] = VLW_NO_GLYPH;
+
+  uint16_t* sorted = gLookup + 0x80;
+  gLookupCount = 0;
+
+  for (uint16_t gNum = 0; gNum < gFont.gCount; gNum++)
+  {
+    uint16_t code = gUnicode[gNum];
+    if (code < 0x80)
+    {
+      // Keep the first glyph if a code is duplicated, as the linear search did
+      if (gLookup[code] == VLW_NO_GLYPH) gLookup[code] = gNum;
+      continue;
+    }
+
+    // Insertion sort, fonts are normally created in code point order so this is
+    // just an append. Equal codes stay in file order.
+    uint16_t i = gLookupCount++;
+    while (i > 0 && gUnicode[sorted[i - 1]] > code)
+    {
+      sorted[i] = sorted[i - 1];
+      i--;
+    }
+    sorted[i] = gNum;
+  }
 }
 
 
@@ -296,6 +346,15 @@ void TFT_eSPI::unloadFont( void )
     gBitmap = NULL;
   }
 
+  if (gLookup)
+  {
+    free(gLookup);
+    gLookup = NULL;
+  }
+  gLookupCount = 0;
+
+  clearGlyphCache(); // Glyph numbers are only valid for this font
+
   gFont.gArray = nullptr;
 
 #ifdef FONT_FS_AVAILABLE
@@ -340,6 +399,33 @@ uint32_t TFT_eSPI::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
+  if (gLookup)
+  {
+    if (unicode < 0x80)
+    {
+      if (gLookup[unicode] == VLW_NO_GLYPH) return false;
+      *index = gLookup[unicode];
+      return true;
+    }
+
+    // Binary search for the first sorted entry not below the code
+    const uint16_t* sorted = gLookup + 0x80;
+    uint16_t lo = 0, hi = gLookupCount;
+    while (lo < hi)
+    {
+      uint16_t mid = (lo + hi) >> 1;
+      if (gUnicode[sorted[mid]] < unicode) lo = mid + 1;
+      else hi = mid;
+    }
+    if (lo < gLookupCount && gUnicode[sorted[lo]] == unicode)
+    {
+      *index = sorted[lo];
+      return true;
+    }
+    return false;
+  }
+
+  // No index, search all glyphs
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
     if (gUnicode[i] == unicode)
@@ -352,6 +438,165 @@ bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 }
 
 
+/***************************************************************************************
+** Function name:           setGlyphCache
+** Description:             Set the RAM budget for caching glyphs of a font file
+*************************************************************************************x*/
+// Only fonts loaded from a file system are cached, array fonts are already in memory.
+// The cache is emptied, and the statistics reset, each time this is called.
+void TFT_eSPI::setGlyphCache(uint32_t bytes, bool usePSRAM)
+{
+  clearGlyphCache();
+  gCacheBudget = bytes;
+  gCachePSRAM  = usePSRAM;
+  gCacheStats  = { 0, 0, 0, 0, 0 };
+}
+
+
+/***************************************************************************************
+** Function name:           getGlyphCacheStats
+** Description:             Return the glyph cache hit/miss statistics
+*************************************************************************************x*/
+TFT_eSPI::glyphCacheStats TFT_eSPI::getGlyphCacheStats(void)
+{
+  return gCacheStats;
+}
+
+
+/***************************************************************************************
+** Function name:           clearGlyphCache
+** Description:             Free all cached glyphs
+*************************************************************************************x*/
+void TFT_eSPI::clearGlyphCache(void)
+{
+  while (gCacheHead)
+  {
+    glyphCacheEntry* next = gCacheHead->next;
+    free(gCacheHead);
+    gCacheHead = next;
+  }
+  gCacheTail = NULL;
+
+  if (gCacheIndex)
+  {
+    free(gCacheIndex);
+    gCacheIndex = NULL;
+  }
+
+  gCacheStats.bytes  = 0;
+  gCacheStats.glyphs = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           getCachedGlyph
+** Description:             Get a glyph bitmap from the cache, reading it on a miss
+*************************************************************************************x*/
+// Returns nullptr if the glyph cannot be cached, the caller then reads the file row by row.
+// On a miss the whole bitmap is read with one file access and the least recently used
+// glyphs are dropped until it fits in the budget.
+const uint8_t* TFT_eSPI::getCachedGlyph(uint16_t gNum)
+{
+#ifdef FONT_FS_AVAILABLE
+  if (!fs_font || gCacheBudget == 0) return nullptr;
+
+  if (gCacheIndex == NULL)
+  {
+    gCacheIndex = (glyphCacheEntry**)calloc(gFont.gCount, sizeof(glyphCacheEntry*));
+    if (gCacheIndex == NULL) return nullptr;
+  }
+
+  glyphCacheEntry* entry = gCacheIndex[gNum];
+
+  if (entry)
+  {
+    gCacheStats.hits++;
+    // Move to the front of the list
+    if (entry != gCacheHead)
+    {
+      entry->prev->next = entry->next;
+      if (entry->next) entry->next->prev = entry->prev;
+      else gCacheTail = entry->prev;
+      entry->prev = NULL;
+      entry->next = gCacheHead;
+      gCacheHead->prev = entry;
+      gCacheHead = entry;
+    }
+    return (const uint8_t*)(entry + 1);
+  }
+
+  gCacheStats.misses++;
+
+  uint32_t bitmapSize = gWidth[gNum] * gHeight[gNum];
+  uint32_t entrySize  = sizeof(glyphCacheEntry) + bitmapSize;
+  if (entrySize > gCacheBudget) return nullptr;
+
+  // Make room, dropping least recently used glyphs
+  while (gCacheTail && (gCacheStats.bytes + entrySize > gCacheBudget))
+  {
+    glyphCacheEntry* old = gCacheTail;
+    gCacheTail = old->prev;
+    if (gCacheTail) gCacheTail->next = NULL;
+    else gCacheHead = NULL;
+    gCacheIndex[old->gNum] = NULL;
+    gCacheStats.bytes -= sizeof(glyphCacheEntry) + gWidth[old->gNum] * gHeight[old->gNum];
+    gCacheStats.glyphs--;
+    gCacheStats.evictions++;
+    free(old);
+  }
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( gCachePSRAM && psramFound() ) entry = (glyphCacheEntry*)ps_malloc( entrySize );
+  else
+#endif
+  entry = (glyphCacheEntry*)malloc( entrySize );
+
+  if (entry == NULL) return nullptr;
+
+  uint8_t* bitmap = (uint8_t*)(entry + 1);
+  fontFile.seek(gBitmap[gNum], fs::SeekSet);
+  if (fontFile.read(bitmap, bitmapSize) != bitmapSize)
+  {
+    free(entry);
+    return nullptr;
+  }
+
+  entry->gNum = gNum;
+  entry->prev = NULL;
+  entry->next = gCacheHead;
+  if (gCacheHead) gCacheHead->prev = entry;
+  else gCacheTail = entry;
+  gCacheHead = entry;
+  gCacheIndex[gNum] = entry;
+  gCacheStats.bytes += entrySize;
+  gCacheStats.glyphs++;
+
+  return bitmap;
+#else
+  gNum = gNum; // Avoid unused variable warning
+  return nullptr;
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           setAlphaRamp
+** Description:             Precompute the blended colours for a fg/bg colour pair
+*************************************************************************************x*/
+void TFT_eSPI::setAlphaRamp(uint16_t fg, uint16_t bg)
+{
+  if (gRampValid && fg == gRampFg && bg == gRampBg) return;
+
+  // Level n is used for alpha values n * 8 to n * 8 + 7, blend at the scaled level
+  // so that level 0 is the background and level 31 the foreground colour
+  for (uint8_t n = 0; n < 32; n++) gRamp[n] = alphaBlend((n << 3) | (n >> 2), fg, bg);
+
+  gRampFg = fg;
+  gRampBg = bg;
+  gRampValid = true;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawGlyph
 ** Description:             Write a character to the TFT cursor position
@@ -406,9 +651,10 @@ void TFT_eSPI::drawGlyph(uint16_t code)
 
     uint8_t* pbuffer = nullptr;
     const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* cached = getCachedGlyph(gNum); // Whole bitmap in RAM, or nullptr
 
 #ifdef FONT_FS_AVAILABLE
-    if (fs_font)
+    if (fs_font && !cached)
     {
       fontFile.seek(gBitmap[gNum], fs::SeekSet);
       pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
@@ -418,6 +664,62 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     int16_t cy = cursor_y + gFont.maxAscent - gdY[gNum];
     int16_t cx = cursor_x + gdX[gNum];
 
+    // Opaque text on a known background, when the bitmap is in memory and inside the
+    // character cell: stream the cell through one window as runs of equal colour, with
+    // anti-aliased edge pixels taken from the precomputed colour ramp
+    const uint8_t* gMem = cached;
+#ifdef FONT_FS_AVAILABLE
+    if (!fs_font)
+#endif
+    gMem = gPtr + gBitmap[gNum];
+
+    int32_t xd = bg_cursor_x + _xDatum;
+    int32_t yd = cursor_y + _yDatum;
+    int32_t cw = cursor_x + gxAdvance[gNum] - bg_cursor_x;
+    int32_t ch = gFont.yAdvance;
+
+    if (_fillbg && !getColor && fg != bg && gMem && cw > 0 &&
+        cx >= bg_cursor_x && cx + gWidth[gNum] <= cursor_x + gxAdvance[gNum] &&
+        cy >= cursor_y && cy + gHeight[gNum] <= cursor_y + ch &&
+        xd >= _vpX && xd + cw <= _vpW && yd >= _vpY && yd + ch <= _vpH)
+    {
+      setAlphaRamp(fg, bg);
+
+      startWrite();
+      setWindow(xd, yd, xd + cw - 1, yd + ch - 1);
+
+      uint16_t runColor = bg;
+      uint32_t run = 0;
+
+      for (int32_t y = cursor_y; y < cursor_y + ch; y++)
+      {
+        bool glyphRow = (y >= cy) && (y < cy + gHeight[gNum]);
+        const uint8_t* row = glyphRow ? gMem + gWidth[gNum] * (y - cy) : gMem;
+        for (int32_t x = bg_cursor_x; x < bg_cursor_x + cw; x++)
+        {
+          uint16_t color = bg;
+          if (glyphRow && x >= cx && x < cx + gWidth[gNum]) {
+            uint8_t alpha = pgm_read_byte(row + x - cx);
+            color = (alpha == 0xFF) ? fg : gRamp[alpha >> 3];
+          }
+          if (color != runColor) {
+            if (run) pushBlock(runColor, run);
+            runColor = color;
+            run = 0;
+          }
+          run++;
+        }
+      }
+      if (run) pushBlock(runColor, run);
+
+      endWrite();
+
+      cursor_x += gxAdvance[gNum];
+      bg_cursor_x = cursor_x;
+      last_cursor_x = cursor_x;
+      return;
+    }
+
     //  if (cx > width() && bg_cursor_x > width()) return;
     //  if (cursor_y > height()) return;
 
@@ -461,7 +763,7 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         if (spiffs)
         {
           fontFile.read(pbuffer, gWidth[gNum]);
@@ -479,6 +781,8 @@ void TFT_eSPI::drawGlyph(uint16_t code)
 
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
+        if (cached) pixel = cached[x + gWidth[gNum] * y];
+        else
 #ifdef FONT_FS_AVAILABLE
         if (fs_font) pixel = pbuffer[x];
         else
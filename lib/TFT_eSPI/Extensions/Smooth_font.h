@@ -16,6 +16,20 @@
 
   void     showFont(uint32_t td);
 
+  // Keep recently drawn glyph bitmaps of a font file in RAM, bytes = 0 disables the cache
+  void     setGlyphCache(uint32_t bytes, bool usePSRAM = false);
+
+  typedef struct
+  {
+    uint32_t hits;                   // Glyphs drawn from the cache
+    uint32_t misses;                 // Glyphs read from the font file
+    uint32_t evictions;              // Least recently used glyphs dropped to stay in budget
+    uint32_t bytes;                  // RAM in use, including entry headers
+    uint16_t glyphs;                 // Glyphs in the cache
+  } glyphCacheStats;
+
+  glyphCacheStats getGlyphCacheStats(void);
+
  // This is for the whole font
   typedef struct
   {
@@ -40,6 +54,10 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   int8_t*   gdX = NULL;       //leftExtent
   uint32_t* gBitmap = NULL;   //file pointer to greyscale bitmap
 
+  // Lookup index for getUnicodeIndex(), built by loadMetrics()
+  uint16_t* gLookup = NULL;   //glyph number for codes 0x00-0x7F (or 0xFFFF), then other glyph numbers sorted by code
+  uint16_t  gLookupCount = 0; //number of sorted entries after the first 0x80
+
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
 
 #ifdef FONT_FS_AVAILABLE
@@ -55,7 +73,34 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   private:
 
   void     loadMetrics(void);
+  void     buildUnicodeIndex(void);
   uint32_t readInt32(void);
 
   uint8_t* fontPtr = nullptr;
 
+  // Glyph cache, a doubly linked list in least recently used order, the bitmap follows each entry
+  typedef struct glyphCacheEntry
+  {
+    struct glyphCacheEntry* prev;    // More recently used
+    struct glyphCacheEntry* next;    // Less recently used
+    uint16_t gNum;                   // Glyph number
+  } glyphCacheEntry;
+
+  const uint8_t* getCachedGlyph(uint16_t gNum);
+  void     clearGlyphCache(void);
+
+  glyphCacheEntry** gCacheIndex = NULL; // Cache entry per glyph number, NULL if not cached
+  glyphCacheEntry*  gCacheHead  = NULL; // Most recently used
+  glyphCacheEntry*  gCacheTail  = NULL; // Least recently used
+  uint32_t gCacheBudget = 0;            // Byte budget, 0 = cache off
+  bool     gCachePSRAM  = false;        // Allocate cache entries in PSRAM if available
+  glyphCacheStats gCacheStats = { 0, 0, 0, 0, 0 };
+
+  // Colours for 32 alpha levels between the text background and foreground, so opaque
+  // anti-aliased text needs a table lookup per pixel instead of alphaBlend()
+  void     setAlphaRamp(uint16_t fg, uint16_t bg);
+
+  uint16_t gRamp[32];
+  uint16_t gRampFg = 0, gRampBg = 0;
+  bool     gRampValid = false;
+
@@ -36,6 +36,9 @@ TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
 
   _colorMap = nullptr;
 
+  _dirty    = nullptr;
+  _dirtyAny = false;
+
   _psram_enable = true;
   
   // Ensure end_tft_write() does nothing in inherited functions.
@@ -242,6 +245,9 @@ void TFT_eSprite::createPalette(uint16_t colorMap[], uint8_t colors)
   {
     _colorMap[i] = colorMap[i];
   }
+
+  // Every pixel may change colour
+  if (_dirty) markDirty(0, 0, _dwidth, _dheight);
 }
 
 
@@ -269,6 +275,9 @@ void TFT_eSprite::createPalette(const uint16_t colorMap[], uint8_t colors)
   {
     _colorMap[i] = pgm_read_word(colorMap++);
   }
+
+  // Every pixel may change colour
+  if (_dirty) markDirty(0, 0, _dwidth, _dheight);
 }
 
 
@@ -350,7 +359,12 @@ void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color)
 {
   if (_colorMap == nullptr || index > 15) return; // out of bounds
 
+  if (_colorMap[index] == color) return;
+
   _colorMap[index] = color;
+
+  // Pixels using the index are not tracked so all need pushing
+  if (_dirty) markDirty(0, 0, _dwidth, _dheight);
 }
 
 
@@ -378,6 +392,12 @@ void TFT_eSprite::deleteSprite(void)
     _colorMap = nullptr;
   }
 
+  if (_dirty != nullptr)
+  {
+    free(_dirty);
+    _dirty = nullptr;
+  }
+
   if (_created)
   {
     free(_img8_1);
@@ -891,6 +911,155 @@ bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int
 }
 
 
+/***************************************************************************************
+** Function name:           setDirtyTracking
+** Description:             Start or stop tracking the changed area of each line
+***************************************************************************************/
+bool TFT_eSprite::setDirtyTracking(bool enable)
+{
+  if (!enable)
+  {
+    if (_dirty) free(_dirty);
+    _dirty = nullptr;
+    _dirtyAny = false;
+    return true;
+  }
+
+  if (!_created || _bpp == 1) return false;
+  if (_dirty) return true;
+
+  _dirty = (uint16_t*) malloc(_dheight * 2 * sizeof(uint16_t));
+  if (_dirty == nullptr) return false;
+
+  // Everything needs to be pushed the first time
+  for (int32_t y = 0; y < _dheight; y++)
+  {
+    _dirty[2 * y]     = 0;
+    _dirty[2 * y + 1] = _dwidth - 1;
+  }
+  _dirtyAny = true;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           markDirty
+** Description:             Extend the changed spans of lines y to y+h-1 to cover x to x+w-1
+***************************************************************************************/
+void TFT_eSprite::markDirty(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (_dirty == nullptr) return;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _dwidth)  w = _dwidth  - x;
+  if ((y + h) > _dheight) h = _dheight - y;
+  if ((w < 1) || (h < 1)) return;
+
+  uint16_t x1 = x + w - 1;
+  uint16_t *span = _dirty + 2 * y;
+  while (h--)
+  {
+    if (x  < span[0]) span[0] = x;
+    if (x1 > span[1]) span[1] = x1;
+    span += 2;
+  }
+  _dirtyAny = true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushDirty
+** Description:             Push the changed spans to the TFT and mark them unchanged
+***************************************************************************************/
+// Consecutive lines with the same span are sent as one block when the span is the full
+// sprite width, otherwise a window is set per line. 4-bit spans are widened to whole
+// bytes and expanded through the palette by pushImage().
+uint32_t TFT_eSprite::pushDirty(int32_t x, int32_t y)
+{
+  if (!_created || _dirty == nullptr || !_dirtyAny) return 0;
+
+  uint32_t pixels = 0;
+
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+  _tft->startWrite();
+
+  int32_t ys = 0;
+  while (ys < _dheight)
+  {
+    uint16_t x0 = _dirty[2 * ys];
+    uint16_t x1 = _dirty[2 * ys + 1];
+
+    if (x0 > x1) { ys++; continue; }
+
+    // Count the following lines with the same span
+    int32_t lines = 1;
+    while ((ys + lines < _dheight) && (_dirty[2 * (ys + lines)] == x0) && (_dirty[2 * (ys + lines) + 1] == x1)) lines++;
+
+    if (_bpp == 4)
+    {
+      x0 &= 0xFFFE;                          // Start on a byte boundary
+      if (!(x1 & 1) && (x1 + 1 < _dwidth)) x1++; // End on a byte boundary if inside the sprite
+    }
+    int32_t sw = x1 - x0 + 1;
+
+    // Full width lines are contiguous in RAM so can be sent as a block
+    int32_t block = (sw == _dwidth) ? lines : 1;
+
+    for (int32_t yp = ys; yp < ys + lines; yp += block)
+    {
+      if (_bpp == 16)
+        _tft->pushImage(x + x0, y + yp, sw, block, _img + x0 + _iwidth * yp);
+      else if (_bpp == 8)
+        _tft->pushImage(x + x0, y + yp, sw, block, _img8 + x0 + _iwidth * yp, (bool)true);
+      else
+        _tft->pushImage(x + x0, y + yp, sw, block, _img4 + ((x0 + _iwidth * yp) >> 1), false, _colorMap);
+    }
+    pixels += sw * lines;
+
+    // Mark the lines unchanged
+    for (int32_t yp = ys; yp < ys + lines; yp++)
+    {
+      _dirty[2 * yp]     = 0xFFFF;
+      _dirty[2 * yp + 1] = 0;
+    }
+    ys += lines;
+  }
+
+  _tft->endWrite();
+  _tft->setSwapBytes(oldSwapBytes);
+
+  _dirtyAny = false;
+  return pixels;
+}
+
+
+/***************************************************************************************
+** Function name:           expandLines
+** Description:             Expand whole lines of a 1 bpp sprite to 16-bit colours
+***************************************************************************************/
+bool TFT_eSprite::expandLines(int32_t y, int32_t h, uint16_t *buffer)
+{
+  if (!_created || _bpp != 1 || rotation != 0 || buffer == nullptr) return false;
+  if ((y < 0) || (h < 1) || (y + h > _dheight)) return false;
+
+  uint16_t fg = (_tft->bitmap_fg >> 8) | (_tft->bitmap_fg << 8);
+  uint16_t bg = (_tft->bitmap_bg >> 8) | (_tft->bitmap_bg << 8);
+
+  uint8_t *ptr = _img8 + (_bitwidth >> 3) * y;
+  while (h--)
+  {
+    expand1bpp(buffer, ptr, 0, _dwidth, fg, bg);
+    buffer += _dwidth;
+    ptr += _bitwidth >> 3;
+  }
+
+  return true;
+}
+
+
 /***************************************************************************************
 ** Function name:           readPixelValue
 ** Description:             Read the color map index of a pixel at defined coordinates
@@ -1034,6 +1203,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
 
   PI_CLIP;
 
+  if (_dirty) markDirty(x, y, dw, dh);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     // Pointer within original image
@@ -1177,6 +1348,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
 
   PI_CLIP;
 
+  if (_dirty) markDirty(x, y, dw, dh);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = dy; yp < dy + dh; yp++)
@@ -1291,6 +1464,8 @@ void TFT_eSprite::pushColor(uint16_t color)
 {
   if (!_created ) return;
 
+  if (_dirty) markDirty(_xptr, _yptr, 1, 1);
+
   // Write the colour to RAM in set window
   if (_bpp == 16)
     _img [_xptr + _yptr * _iwidth] = (uint16_t) (color >> 8) | (color << 8);
@@ -1355,6 +1530,8 @@ void TFT_eSprite::writeColor(uint16_t color)
 {
   if (!_created ) return;
 
+  if (_dirty) markDirty(_xptr, _yptr, 1, 1);
+
   // Write 16-bit RGB 565 encoded colour to RAM
   if (_bpp == 16) _img [_xptr + _yptr * _iwidth] = color;
 
@@ -1423,6 +1600,8 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
     return;
   }
 
+  if (_dirty) markDirty(_sx, _sy, _sw, _sh);
+
   // Fetch the scroll area width and height set by setScrollRect()
   uint32_t w  = _sw - abs(dx); // line width to copy
   uint32_t h  = _sh - abs(dy); // lines to copy
@@ -1520,6 +1699,8 @@ void TFT_eSprite::fillSprite(uint32_t color)
   // Use memset if possible as it is super fast
   if(_xDatum == 0 && _yDatum == 0  &&  _xWidth == width())
   {
+    if (_dirty) markDirty(0, 0, _dwidth, _dheight);
+
     if(_bpp == 16) {
       if ( (uint8_t)color == (uint8_t)(color>>8) ) {
         memset(_img,  (uint8_t)color, _iwidth * _yHeight * 2);
@@ -1637,6 +1818,8 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
   // Range checking
   if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return;
 
+  if (_dirty) markDirty(x, y, 1, 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1761,6 +1944,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   if (h < 1) return;
 
+  if (_dirty) markDirty(x, y, 1, h);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1822,6 +2007,8 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   if (w < 1) return;
 
+  if (_dirty) markDirty(x, y, w, 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1887,6 +2074,8 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 
   if ((w < 1) || (h < 1)) return;
 
+  if (_dirty) markDirty(x, y, w, h);
+
   int32_t yp = _iwidth * y + x;
 
   if (_bpp == 16)
@@ -2085,7 +2274,7 @@ void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uin
       uint32_t bo = pgm_read_word(&glyph->bitmapOffset);
 
       uint8_t  xx, yy, bits=0, bit=0;
-      //uint8_t  xa = pgm_read_byte(&glyph->xAdvance);
+      uint8_t  xa = pgm_read_byte(&glyph->xAdvance);
       int16_t  xo16 = 0, yo16 = 0;
 
       if(size > 1) {
@@ -2093,6 +2282,22 @@ void TFT_eSprite::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uin
         yo16 = yo;
       }
 
+      // Opaque rendering, enabled with setTextColor(fg, bg, true): paint the whole
+      // character cell as TFT_eSPI::drawChar() does. Sprite writes go to RAM, so
+      // the cell is filled and the glyph drawn transparently on top.
+      if (_fillbg && (bg != color)) {
+        int32_t cx0 = (xo < 0) ? xo : 0;                   // Cell bounds relative to x, y
+        int32_t cx1 = (xo + w > xa) ? xo + w : xa;
+        int32_t cy0 = (yo < -glyph_ab) ? yo : -glyph_ab;
+        int32_t cy1 = (yo + h > glyph_bb) ? yo + h : glyph_bb;
+        fillRect(x + cx0 * size, y + cy0 * size, (cx1 - cx0) * size, (cy1 - cy0) * size, bg);
+      }
+
+      if (_gfxRLE) {
+        drawCharRLE(x, y, bitmap + bo, h, xo, yo, color, size);
+        return;
+      }
+
       uint16_t hpc = 0; // Horizontal foreground pixel count
       for(yy=0; yy<h; yy++) {
         for(xx=0; xx<w; xx++) {
@@ -2477,9 +2682,10 @@ void TFT_eSprite::drawGlyph(uint16_t code)
 
     uint8_t* pbuffer = nullptr;
     const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* cached = getCachedGlyph(gNum); // Whole bitmap in RAM, or nullptr
 
 #ifdef FONT_FS_AVAILABLE
-    if (fs_font) {
+    if (fs_font && !cached) {
       fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
       pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
     }
@@ -2528,13 +2734,15 @@ void TFT_eSprite::drawGlyph(uint16_t code)
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         fontFile.read(pbuffer, gWidth[gNum]);
       }
 #endif
 
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
+        if (cached) pixel = cached[x + gWidth[gNum] * y];
+        else
 #ifdef FONT_FS_AVAILABLE
         if (fs_font) pixel = pbuffer[x];
         else
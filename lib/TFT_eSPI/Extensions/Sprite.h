@@ -126,6 +126,19 @@ class TFT_eSprite : public TFT_eSPI {
            // Push a windowed area of the sprite to the TFT at tx, ty
   bool     pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
 
+           // Track the changed x span of every line of a 4, 8 or 16-bit sprite (call after createSprite),
+           // so a full screen sprite can be used as a frame buffer and only the changes pushed.
+           // Returns false if tracking is not possible or there is not enough RAM
+  bool     setDirtyTracking(bool enable);
+           // Mark an area as changed, sprite coordinates. Palette changes mark the whole sprite
+  void     markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+           // Push the changed spans to the TFT with the sprite at x,y and clear them, returns pixels pushed
+  uint32_t pushDirty(int32_t x, int32_t y);
+
+           // Expand lines y to y+h-1 of an unrotated 1-bit sprite to the setBitmapColor() colours
+           // in display byte order, e.g. to send with pushImageDMA(). The buffer must hold width() * h pixels
+  bool     expandLines(int32_t y, int32_t h, uint16_t *buffer);
+
            // Push the sprite to another sprite at x,y. This fn calls pushImage() in the destination sprite (dspr) class.
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent);
@@ -170,6 +183,9 @@ class TFT_eSprite : public TFT_eSPI {
 
   uint16_t *_colorMap; // color map pointer: 16 entries, used with 4-bit color map.
 
+  uint16_t *_dirty;    // Changed span per line, first and last x (first > last if unchanged), nullptr if not tracked
+  bool     _dirtyAny;  // At least one line has a changed span
+
   int32_t  _sinra;   // Sine of rotation angle in fixed point
   int32_t  _cosra;   // Cosine of rotation angle in fixed point
 
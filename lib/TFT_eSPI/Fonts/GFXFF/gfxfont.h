@@ -25,6 +25,19 @@ typedef struct { // Data stored for FONT AS A WHOLE:
 	uint8_t   yAdvance;    // Newline distance (y axis)
 } GFXfont;
 
+// Run-length encoded free font, select with setFreeFontRLE() and create with
+// Tools/gfxff2rle. Same layout as GFXfont, but each glyph bitmap is a list of
+// row groups, each made of:
+//   1 header byte: bits 0-3 = number of foreground runs n (0-15) in the row,
+//                  bits 4-7 = extra rows r, the group covers r+1 identical rows
+//   n byte pairs:  background pixels to skip, then foreground run length
+typedef struct { // Data stored for FONT AS A WHOLE:
+	uint8_t  *bitmap;      // RLE glyph row groups, concatenated
+	GFXglyph *glyph;       // Glyph array, bitmapOffset points into the RLE data
+	uint16_t  first, last; // ASCII extents
+	uint8_t   yAdvance;    // Newline distance (y axis)
+} GFXrlefont;
+
   // Original Adafruit_GFX "Free Fonts"
   #include <Fonts/GFXFF/TomThumb.h>  // TT1
 
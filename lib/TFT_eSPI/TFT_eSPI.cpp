@@ -37,6 +37,18 @@
   #define SPI_BUSY_CHECK
 #endif
 
+// The ILI9341 keeps the column and row address ranges until they are set again, so for an
+// ILI9341 on a SPI bus setWindow() only sends the range that differs from the last window.
+// Runs of windows sharing columns (sprite lines, dirty spans) or rows (glyph runs) then
+// need one address command instead of two. addr_col and addr_row hold the last ranges
+// sent as (start << 16) | end, 0xFFFF when unknown (init, rotation, reads).
+// Define TFT_NO_WINDOW_CACHE to always send both ranges.
+#if (defined (ILI9341_DRIVER) || defined (ILI9341_2_DRIVER)) && !defined (TFT_PARALLEL_8_BIT) && !defined (TFT_PARALLEL_16_BIT) && \
+    !defined (RPI_DISPLAY_TYPE) && !defined (ARDUINO_ARCH_RP2040) && !defined (ARDUINO_ARCH_MBED) && !defined (CGRAM_OFFSET) && \
+    !defined (TFT_NO_WINDOW_CACHE)
+  #define TFT_WINDOW_CACHE
+#endif
+
 // Clipping macro for pushImage
 #define PI_CLIP                                        \
   if (_vpOoB) return;                                  \
@@ -58,6 +70,85 @@
                                                        \
   if (dw < 1 || dh < 1) return;
 
+// RGB332 to RGB565 colours for 8-bit images and sprites, the same values as color8to16() but
+// with the bytes swapped so that the line buffer holds the pixels in display (MSB first) order
+static const uint16_t rgb332_swapped[256] PROGMEM = {
+  0x0000, 0x0B00, 0x1500, 0x1F00, 0x2001, 0x2B01, 0x3501, 0x3F01,
+  0x4002, 0x4B02, 0x5502, 0x5F02, 0x6003, 0x6B03, 0x7503, 0x7F03,
+  0x8004, 0x8B04, 0x9504, 0x9F04, 0xA005, 0xAB05, 0xB505, 0xBF05,
+  0xC006, 0xCB06, 0xD506, 0xDF06, 0xE007, 0xEB07, 0xF507, 0xFF07,
+  0x0020, 0x0B20, 0x1520, 0x1F20, 0x2021, 0x2B21, 0x3521, 0x3F21,
+  0x4022, 0x4B22, 0x5522, 0x5F22, 0x6023, 0x6B23, 0x7523, 0x7F23,
+  0x8024, 0x8B24, 0x9524, 0x9F24, 0xA025, 0xAB25, 0xB525, 0xBF25,
+  0xC026, 0xCB26, 0xD526, 0xDF26, 0xE027, 0xEB27, 0xF527, 0xFF27,
+  0x0048, 0x0B48, 0x1548, 0x1F48, 0x2049, 0x2B49, 0x3549, 0x3F49,
+  0x404A, 0x4B4A, 0x554A, 0x5F4A, 0x604B, 0x6B4B, 0x754B, 0x7F4B,
+  0x804C, 0x8B4C, 0x954C, 0x9F4C, 0xA04D, 0xAB4D, 0xB54D, 0xBF4D,
+  0xC04E, 0xCB4E, 0xD54E, 0xDF4E, 0xE04F, 0xEB4F, 0xF54F, 0xFF4F,
+  0x0068, 0x0B68, 0x1568, 0x1F68, 0x2069, 0x2B69, 0x3569, 0x3F69,
+  0x406A, 0x4B6A, 0x556A, 0x5F6A, 0x606B, 0x6B6B, 0x756B, 0x7F6B,
+  0x806C, 0x8B6C, 0x956C, 0x9F6C, 0xA06D, 0xAB6D, 0xB56D, 0xBF6D,
+  0xC06E, 0xCB6E, 0xD56E, 0xDF6E, 0xE06F, 0xEB6F, 0xF56F, 0xFF6F,
+  0x0090, 0x0B90, 0x1590, 0x1F90, 0x2091, 0x2B91, 0x3591, 0x3F91,
+  0x4092, 0x4B92, 0x5592, 0x5F92, 0x6093, 0x6B93, 0x7593, 0x7F93,
+  0x8094, 0x8B94, 0x9594, 0x9F94, 0xA095, 0xAB95, 0xB595, 0xBF95,
+  0xC096, 0xCB96, 0xD596, 0xDF96, 0xE097, 0xEB97, 0xF597, 0xFF97,
+  0x00B0, 0x0BB0, 0x15B0, 0x1FB0, 0x20B1, 0x2BB1, 0x35B1, 0x3FB1,
+  0x40B2, 0x4BB2, 0x55B2, 0x5FB2, 0x60B3, 0x6BB3, 0x75B3, 0x7FB3,
+  0x80B4, 0x8BB4, 0x95B4, 0x9FB4, 0xA0B5, 0xABB5, 0xB5B5, 0xBFB5,
+  0xC0B6, 0xCBB6, 0xD5B6, 0xDFB6, 0xE0B7, 0xEBB7, 0xF5B7, 0xFFB7,
+  0x00D8, 0x0BD8, 0x15D8, 0x1FD8, 0x20D9, 0x2BD9, 0x35D9, 0x3FD9,
+  0x40DA, 0x4BDA, 0x55DA, 0x5FDA, 0x60DB, 0x6BDB, 0x75DB, 0x7FDB,
+  0x80DC, 0x8BDC, 0x95DC, 0x9FDC, 0xA0DD, 0xABDD, 0xB5DD, 0xBFDD,
+  0xC0DE, 0xCBDE, 0xD5DE, 0xDFDE, 0xE0DF, 0xEBDF, 0xF5DF, 0xFFDF,
+  0x00F8, 0x0BF8, 0x15F8, 0x1FF8, 0x20F9, 0x2BF9, 0x35F9, 0x3FF9,
+  0x40FA, 0x4BFA, 0x55FA, 0x5FFA, 0x60FB, 0x6BFB, 0x75FB, 0x7FFB,
+  0x80FC, 0x8BFC, 0x95FC, 0x9FFC, 0xA0FD, 0xABFD, 0xB5FD, 0xBFFD,
+  0xC0FE, 0xCBFE, 0xD5FE, 0xDFFE, 0xE0FF, 0xEBFF, 0xF5FF, 0xFFFF
+};
+
+// Expand w pixels of a 1 bit per pixel image line, starting at pixel x, to 16-bit colours.
+// fg and bg must already be in display byte order. Bits are expanded a byte at a time and
+// all background or all foreground bytes are written as runs of one colour.
+static void expand1bpp(uint16_t *out, const uint8_t *data, int32_t x, int32_t w, uint16_t fg, uint16_t bg)
+{
+  uint16_t pal[2] = { bg, fg };
+  const uint8_t *ptr = data + (x >> 3);
+
+  // Pixels up to the first byte boundary
+  if (x & 0x7) {
+    uint8_t bits = pgm_read_byte(ptr++) << (x & 0x7);
+    int32_t n = 8 - (x & 0x7);
+    if (n > w) n = w;
+    w -= n;
+    while (n--) { *out++ = pal[bits >> 7]; bits <<= 1; }
+  }
+
+  // Whole bytes
+  while (w >= 8) {
+    uint8_t bits = pgm_read_byte(ptr++);
+    if (bits == 0x00 || bits == 0xFF) {
+      uint16_t color = pal[bits & 1];
+      out[0] = color; out[1] = color; out[2] = color; out[3] = color;
+      out[4] = color; out[5] = color; out[6] = color; out[7] = color;
+    }
+    else {
+      out[0] = pal[(bits >> 7)    ]; out[1] = pal[(bits >> 6) & 1];
+      out[2] = pal[(bits >> 5) & 1]; out[3] = pal[(bits >> 4) & 1];
+      out[4] = pal[(bits >> 3) & 1]; out[5] = pal[(bits >> 2) & 1];
+      out[6] = pal[(bits >> 1) & 1]; out[7] = pal[ bits       & 1];
+    }
+    out += 8;
+    w -= 8;
+  }
+
+  // Remaining pixels
+  if (w > 0) {
+    uint8_t bits = pgm_read_byte(ptr);
+    while (w--) { *out++ = pal[bits >> 7]; bits <<= 1; }
+  }
+}
+
 /***************************************************************************************
 ** Function name:           Legacy - deprecated
 ** Description:             Start/end transaction
@@ -452,7 +543,10 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   textbgcolor = bitmap_bg = 0x0000; // Black
   padX        = 0;                  // No padding
 
-  _fillbg    = false;   // Smooth font only at the moment, force text background fill
+  _fillbg    = false;   // Smooth and free fonts, force text background fill
+#ifdef LOAD_GFXFF
+  _gfxRLE    = false;   // Free font bitmaps are plain 1 bit per pixel
+#endif
 
   isDigits   = false;   // No bounding box adjustment
   textwrapX  = true;    // Wrap text at end of line when using print stream
@@ -1635,37 +1729,25 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
 
   if (bpp8)
   {
-    _swapBytes = false;
-
-    uint8_t  blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
-
-    _lastColor = -1; // Set to illegal value
-
-    // Used to store last shifted colour
-    uint8_t msbColor = 0;
-    uint8_t lsbColor = 0;
+    _swapBytes = false; // Table colours are already in display byte order
 
     data += dx + dy * w;
     while (dh--) {
       uint32_t len = dw;
       uint8_t* ptr = (uint8_t*)data;
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-
-      while(len--) {
-        uint32_t color = pgm_read_byte(ptr++);
-
-        // Shifts are slow so check if colour has changed first
-        if (color != _lastColor) {
-          //          =====Green=====     ===============Red==============
-          msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-          //          =====Green=====    =======Blue======
-          lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
-          _lastColor = color;
-        }
-
-       *linePtr++ = msbColor;
-       *linePtr++ = lsbColor;
+      uint16_t* linePtr = lineBuf;
+
+      // Expand four pixels per loop
+      while (len >= 4) {
+        linePtr[0] = pgm_read_word(&rgb332_swapped[pgm_read_byte(ptr)]);
+        linePtr[1] = pgm_read_word(&rgb332_swapped[pgm_read_byte(ptr + 1)]);
+        linePtr[2] = pgm_read_word(&rgb332_swapped[pgm_read_byte(ptr + 2)]);
+        linePtr[3] = pgm_read_word(&rgb332_swapped[pgm_read_byte(ptr + 3)]);
+        ptr += 4;
+        linePtr += 4;
+        len -= 4;
       }
+      while (len--) *linePtr++ = pgm_read_word(&rgb332_swapped[pgm_read_byte(ptr++)]);
 
       pushPixels(lineBuf, dw);
 
@@ -1727,17 +1809,14 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8
   else // Must be 1bpp
   {
     _swapBytes = false;
-    uint8_t * ptr = (uint8_t*)data;
+    uint16_t fg = (bitmap_fg >> 8) | (bitmap_fg << 8);
+    uint16_t bg = (bitmap_bg >> 8) | (bitmap_bg << 8);
+
     uint32_t ww =  (w+7)>>3; // Width of source image line in bytes
+    const uint8_t * ptr = data + ww * dy;
     for (int32_t yp = dy;  yp < dy + dh; yp++)
     {
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-      for (int32_t xp = dx; xp < dx + dw; xp++)
-      {
-        uint16_t col = (pgm_read_byte(ptr + (xp>>3)) & (0x80 >> (xp & 0x7)) );
-        if (col) {*linePtr++ = bitmap_fg>>8; *linePtr++ = (uint8_t) bitmap_fg;}
-        else     {*linePtr++ = bitmap_bg>>8; *linePtr++ = (uint8_t) bitmap_bg;}
-      }
+      expand1bpp(lineBuf, ptr, dx, dw, fg, bg);
       ptr += ww;
       pushPixels(lineBuf, dw);
     }
@@ -1768,37 +1847,25 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 
   if (bpp8)
   {
-    _swapBytes = false;
-
-    uint8_t  blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
-
-    _lastColor = -1; // Set to illegal value
-
-    // Used to store last shifted colour
-    uint8_t msbColor = 0;
-    uint8_t lsbColor = 0;
+    _swapBytes = false; // Table colours are already in display byte order
 
     data += dx + dy * w;
     while (dh--) {
       uint32_t len = dw;
       uint8_t* ptr = data;
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-
-      while(len--) {
-        uint32_t color = *ptr++;
-
-        // Shifts are slow so check if colour has changed first
-        if (color != _lastColor) {
-          //          =====Green=====     ===============Red==============
-          msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-          //          =====Green=====    =======Blue======
-          lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
-          _lastColor = color;
-        }
-
-       *linePtr++ = msbColor;
-       *linePtr++ = lsbColor;
+      uint16_t* linePtr = lineBuf;
+
+      // Expand four pixels per loop
+      while (len >= 4) {
+        linePtr[0] = pgm_read_word(&rgb332_swapped[ptr[0]]);
+        linePtr[1] = pgm_read_word(&rgb332_swapped[ptr[1]]);
+        linePtr[2] = pgm_read_word(&rgb332_swapped[ptr[2]]);
+        linePtr[3] = pgm_read_word(&rgb332_swapped[ptr[3]]);
+        ptr += 4;
+        linePtr += 4;
+        len -= 4;
       }
+      while (len--) *linePtr++ = pgm_read_word(&rgb332_swapped[*ptr++]);
 
       pushPixels(lineBuf, dw);
 
@@ -1860,17 +1927,14 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
   else // Must be 1bpp
   {
     _swapBytes = false;
+    uint16_t fg = (bitmap_fg >> 8) | (bitmap_fg << 8);
+    uint16_t bg = (bitmap_bg >> 8) | (bitmap_bg << 8);
 
     uint32_t ww =  (w+7)>>3; // Width of source image line in bytes
+    data += ww * dy;
     for (int32_t yp = dy;  yp < dy + dh; yp++)
     {
-      uint8_t* linePtr = (uint8_t*)lineBuf;
-      for (int32_t xp = dx; xp < dx + dw; xp++)
-      {
-        uint16_t col = (data[(xp>>3)] & (0x80 >> (xp & 0x7)) );
-        if (col) {*linePtr++ = bitmap_fg>>8; *linePtr++ = (uint8_t) bitmap_fg;}
-        else     {*linePtr++ = bitmap_bg>>8; *linePtr++ = (uint8_t) bitmap_bg;}
-      }
+      expand1bpp(lineBuf, data, dx, dw, fg, bg);
       data += ww;
       pushPixels(lineBuf, dw);
     }
@@ -1903,18 +1967,10 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
 
     data += dx + dy * w;
 
-    uint8_t  blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
-
-    _lastColor = -1; // Set to illegal value
-
-    // Used to store last shifted colour
-    uint8_t msbColor = 0;
-    uint8_t lsbColor = 0;
-
     while (dh--) {
       int32_t len = dw;
       uint8_t* ptr = data;
-      uint8_t* linePtr = (uint8_t*)lineBuf;
+      uint16_t* linePtr = lineBuf;
 
       int32_t px = x, sx = x;
       bool move = true;
@@ -1923,18 +1979,7 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
       while (len--) {
         if (transp != *ptr) {
           if (move) { move = false; sx = px; }
-          uint8_t color = *ptr;
-
-          // Shifts are slow so check if colour has changed first
-          if (color != _lastColor) {
-            //          =====Green=====     ===============Red==============
-            msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
-            //          =====Green=====    =======Blue======
-            lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
-            _lastColor = color;
-          }
-          *linePtr++ = msbColor;
-          *linePtr++ = lsbColor;
+          *linePtr++ = pgm_read_word(&rgb332_swapped[*ptr]);
           np++;
         }
         else {
@@ -1942,7 +1987,7 @@ void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *da
           if (np) {
             setWindow(sx, y, sx + np - 1, y);
             pushPixels(lineBuf, np);
-            linePtr = (uint8_t*)lineBuf;
+            linePtr = lineBuf;
             np = 0;
           }
         }
@@ -2921,7 +2966,7 @@ void TFT_eSPI::setTextColor(uint16_t c)
 ***************************************************************************************/
 // Smooth fonts use the background colour for anti-aliasing and by default the
 // background is not filled. If bgfill = true, then a smooth font background fill will
-// be used.
+// be used, and free (GFXFF) font characters are drawn opaque over their whole cell.
 void TFT_eSPI::setTextColor(uint16_t c, uint16_t b, bool bgfill)
 {
   textcolor   = c;
@@ -3276,8 +3321,8 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
 
       uint32_t bo = pgm_read_word(&glyph->bitmapOffset);
       uint8_t  w  = pgm_read_byte(&glyph->width),
-               h  = pgm_read_byte(&glyph->height);
-               //xa = pgm_read_byte(&glyph->xAdvance);
+               h  = pgm_read_byte(&glyph->height),
+               xa = pgm_read_byte(&glyph->xAdvance);
       int8_t   xo = pgm_read_byte(&glyph->xOffset),
                yo = pgm_read_byte(&glyph->yOffset);
       uint8_t  xx, yy, bits=0, bit=0;
@@ -3288,6 +3333,95 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
         yo16 = yo;
       }
 
+      // Opaque rendering, enabled with setTextColor(fg, bg, true): the whole character
+      // cell (xAdvance wide, font ascent to descent high) is painted so that a glyph
+      // overwrites the previous one without a separate erase pass
+      if (_fillbg && (bg != color)) {
+        int32_t cx0 = (xo < 0) ? xo : 0;                   // Cell bounds relative to x, y
+        int32_t cx1 = (xo + w > xa) ? xo + w : xa;
+        int32_t cy0 = (yo < -glyph_ab) ? yo : -glyph_ab;
+        int32_t cy1 = (yo + h > glyph_bb) ? yo + h : glyph_bb;
+
+        int32_t xd = x + cx0 + _xDatum;
+        int32_t yd = y + cy0 + _yDatum;
+        int32_t cw = cx1 - cx0;
+        int32_t ch = cy1 - cy0;
+        bool clip = xd < _vpX || xd + cw > _vpW || yd < _vpY || yd + ch > _vpH;
+
+        if (size == 1 && !clip) {
+          // Character is within viewport area so stream the cell in one window,
+          // as foreground and background runs (see the RLE font equivalent)
+          begin_tft_write();
+          setWindow(xd, yd, xd + cw - 1, yd + ch - 1);
+
+          uint32_t bgRun = (yo - cy0) * cw; // Rows above the bitmap
+          uint32_t fgRun = 0;
+          if (_gfxRLE) {
+            // Runs are precomputed, each row group is replayed for its repeated rows
+            const uint8_t *rle = bitmap + bo;
+            const uint8_t *runs = rle;
+            for(yy=0; yy<h; ) {
+              uint8_t hdr  = pgm_read_byte(rle++);
+              uint8_t rows = (hdr >> 4) + 1;
+              for (uint8_t r = 0; r < rows; r++) {
+                runs = rle;
+                bgRun += xo - cx0;          // Columns left of the bitmap
+                int32_t xr = 0;
+                for (uint8_t n = hdr & 0x0F; n; n--) {
+                  uint8_t skip = pgm_read_byte(runs++);
+                  uint8_t len  = pgm_read_byte(runs++);
+                  bgRun += skip;
+                  if (bgRun) { pushBlock(bg, bgRun); bgRun = 0; }
+                  pushBlock(color, len);
+                  xr += skip + len;
+                }
+                bgRun += w - xr + cx1 - (xo + w); // Rest of the row
+              }
+              rle = runs;
+              yy += rows;
+            }
+          }
+          else {
+            for(yy=0; yy<h; yy++) {
+              bgRun += xo - cx0;            // Columns left of the bitmap
+              for(xx=0; xx<w; xx++) {
+                if(bit == 0) {
+                  bits = pgm_read_byte(&bitmap[bo++]);
+                  bit  = 0x80;
+                }
+                if(bits & bit) {
+                  if (bgRun) { pushBlock(bg, bgRun); bgRun = 0; }
+                  fgRun++;
+                }
+                else {
+                  if (fgRun) { pushBlock(color, fgRun); fgRun = 0; }
+                  bgRun++;
+                }
+                bit >>= 1;
+              }
+              if (fgRun) { pushBlock(color, fgRun); fgRun = 0; }
+              bgRun += cx1 - (xo + w);      // Columns right of the bitmap
+            }
+          }
+          bgRun += (cy1 - (yo + h)) * cw;   // Rows below the bitmap
+          if (bgRun) pushBlock(bg, bgRun);
+
+          inTransaction = lockTransaction;
+          end_tft_write();
+          return;
+        }
+
+        // Scaled or clipped: fill the cell, then draw the glyph transparently on top
+        fillRect(x + cx0 * size, y + cy0 * size, cw * size, ch * size, bg);
+      }
+
+      if (_gfxRLE) {
+        drawCharRLE(x, y, bitmap + bo, h, xo, yo, color, size);
+        inTransaction = lockTransaction;
+        end_tft_write();
+        return;
+      }
+
       // GFXFF rendering speed up
       uint16_t hpc = 0; // Horizontal foreground pixel count
       for(yy=0; yy<h; yy++) {
@@ -3360,8 +3494,10 @@ void TFT_eSPI::setAddrWindow(int32_t x0, int32_t y0, int32_t w, int32_t h)
 void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
   //begin_tft_write(); // Must be called before setWindow
+#if !defined (TFT_WINDOW_CACHE)
   addr_row = 0xFFFF;
   addr_col = 0xFFFF;
+#endif
 
 #if defined (ILI9225_DRIVER)
   if (rotation & 0x01) { transpose(x0, y0); transpose(x1, y1); }
@@ -3482,10 +3618,25 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
     #endif
   #else
     SPI_BUSY_CHECK;
+  #if defined (TFT_WINDOW_CACHE)
+    int32_t col = (x0 << 16) | (uint16_t)x1;
+    int32_t row = (y0 << 16) | (uint16_t)y1;
+    if (addr_col != col) {
+      DC_C; tft_Write_8(TFT_CASET);
+      DC_D; tft_Write_32C(x0, x1);
+      addr_col = col;
+    }
+    if (addr_row != row) {
+      DC_C; tft_Write_8(TFT_PASET);
+      DC_D; tft_Write_32C(y0, y1);
+      addr_row = row;
+    }
+  #else
     DC_C; tft_Write_8(TFT_CASET);
     DC_D; tft_Write_32C(x0, x1);
     DC_C; tft_Write_8(TFT_PASET);
     DC_D; tft_Write_32C(y0, y1);
+  #endif
     DC_C; tft_Write_8(TFT_RAMWR);
     DC_D;
   #endif // RP2040 SPI
@@ -3756,18 +3907,27 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
       addr_row = y;
     }
   #else
+    #if defined (TFT_WINDOW_CACHE)
+      // Same range format as setWindow()
+      int32_t col = (x << 16) | x;
+      int32_t row = (y << 16) | y;
+    #else
+      int32_t col = x;
+      int32_t row = y;
+    #endif
+
     // No need to send x if it has not changed (speeds things up)
-    if (addr_col != x) {
+    if (addr_col != col) {
       DC_C; tft_Write_8(TFT_CASET);
       DC_D; tft_Write_32D(x);
-      addr_col = x;
+      addr_col = col;
     }
 
     // No need to send y if it has not changed (speeds things up)
-    if (addr_row != y) {
+    if (addr_row != row) {
       DC_C; tft_Write_8(TFT_PASET);
       DC_D; tft_Write_32D(y);
-      addr_row = y;
+      addr_row = row;
     }
   #endif
 
@@ -5622,7 +5782,8 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
         // Add 1 pixel of padding all round
         //cheight +=2;
         //fillRect(poX+xo-1, poY - 1 - glyph_ab * textsize, cwidth+2, cheight, textbgcolor);
-        fillRect(poX+xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+        // Opaque glyphs (setTextColor(fg, bg, true)) paint their own background
+        if (!_fillbg) fillRect(poX+xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
       }
       padding -=100;
     }
@@ -5887,6 +6048,7 @@ void TFT_eSPI::setFreeFont(const GFXfont *f)
 
   textfont = 1;
   gfxFont = (GFXfont *)f;
+  _gfxRLE = false;
 
   glyph_ab = 0;
   glyph_bb = 0;
@@ -5903,6 +6065,46 @@ void TFT_eSPI::setFreeFont(const GFXfont *f)
 }
 
 
+/***************************************************************************************
+** Function name:           setFreeFontRLE
+** Descriptions:            Sets a run-length encoded GFX free font to use
+***************************************************************************************/
+void TFT_eSPI::setFreeFontRLE(const GFXrlefont *f)
+{
+  // Glyph table and metrics are the same as a GFXfont, only the bitmaps differ
+  setFreeFont((const GFXfont *)f);
+  if (f != nullptr) _gfxRLE = true;
+}
+
+
+/***************************************************************************************
+** Function name:           drawCharRLE
+** Description:             draw a run-length encoded free font glyph, see gfxfont.h
+***************************************************************************************/
+// Each run is drawn as one line, or as one rectangle when rows repeat. drawFastHLine()
+// and fillRect() are virtual so this also renders into Sprites.
+void TFT_eSPI::drawCharRLE(int32_t x, int32_t y, const uint8_t *rle, uint8_t h, int8_t xo, int8_t yo, uint32_t color, uint8_t size)
+{
+  int32_t yy = 0;
+  while (yy < h) {
+    uint8_t hdr  = pgm_read_byte(rle++);
+    uint8_t rows = (hdr >> 4) + 1;
+    int32_t xx = 0;
+    for (uint8_t n = hdr & 0x0F; n; n--) {
+      xx += pgm_read_byte(rle++);
+      uint8_t len = pgm_read_byte(rle++);
+      if (size == 1) {
+        if (rows == 1) drawFastHLine(x + xo + xx, y + yo + yy, len, color);
+        else fillRect(x + xo + xx, y + yo + yy, len, rows, color);
+      }
+      else fillRect(x + (xo + xx) * size, y + (yo + yy) * size, len * size, rows * size, color);
+      xx += len;
+    }
+    yy += rows;
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           setTextFont
 ** Description:             Set the font for the print stream
@@ -658,7 +658,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            getCursorY(void);                                // Read current cursor y position
 
   void     setTextColor(uint16_t color),                    // Set character (glyph) color only (background not over-written)
-           setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false),  // Set character (glyph) foreground and background colour, optional background fill for smooth fonts
+           setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false),  // Set character (glyph) foreground and background colour, optional background fill for smooth and free fonts
            setTextSize(uint8_t size);                       // Set character size multiplier (this increases pixel size)
 
   void     setTextWrap(bool wrapX, bool wrapY = false);     // Turn on/off wrapping of text in TFT width and/or height
@@ -671,6 +671,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
 #ifdef LOAD_GFXFF
   void     setFreeFont(const GFXfont *f = NULL),            // Select the GFX Free Font
+           setFreeFontRLE(const GFXrlefont *f),             // Select a run-length encoded GFX Free Font
            setTextFont(uint8_t font);                       // Set the font number to use in future
 #else
   void     setFreeFont(uint8_t font),                       // Not used, historical fix to prevent an error
@@ -938,6 +939,11 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
   bool     _booted;    // init() or begin() has already run once
 
+#ifdef LOAD_GFXFF
+           // Draw a run-length encoded free font glyph (transparent background)
+  void     drawCharRLE(int32_t x, int32_t y, const uint8_t *rle, uint8_t h, int8_t xo, int8_t yo, uint32_t color, uint8_t size);
+#endif
+
                        // User sketch manages these via set/getAttribute()
   bool     _cp437;        // If set, use correct CP437 charset (default is OFF)
   bool     _utf8;         // If set, use UTF-8 decoder in print stream 'write()' function (default ON)
@@ -945,7 +951,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
   uint32_t _lastColor; // Buffered value of last colour used
 
-  bool     _fillbg;    // Fill background flag (just for for smooth fonts at the moment)
+  bool     _fillbg;    // Fill background flag (smooth fonts and opaque free fonts)
 
 #if defined (SSD1963_DRIVER)
   uint16_t Cswap;      // Swap buffer for SSD1963
@@ -954,6 +960,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
 #ifdef LOAD_GFXFF
   GFXfont  *gfxFont;
+  bool     _gfxRLE;    // gfxFont glyph bitmaps are run-length encoded (GFXrlefont)
 #endif
 
 /***************************************************************************************
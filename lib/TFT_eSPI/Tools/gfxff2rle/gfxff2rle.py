@@ -0,0 +1,230 @@
+'''
+
+    This script reads an Adafruit GFX free font header (as produced by
+    fontconvert or https://rop.nl/truetype2gfx/) and writes a run-length
+    encoded version of it for use with TFT_eSPI setFreeFontRLE().
+
+    The RLE glyph format is described in Fonts/GFXFF/gfxfont.h. Glyph rows
+    are stored as precomputed foreground runs and identical consecutive rows
+    are merged, so the renderer draws runs (or whole rectangles) directly
+    instead of testing every bit. Large blocky fonts such as 7-segment digits
+    shrink considerably.
+
+    You'll need python 3.6 or later
+
+    usage: python gfxff2rle.py [-v] MyFont42pt7b.h [-o MyFont42pt7bRLE.h] [-c "0123456789:"]
+
+    Every glyph is decoded again from the RLE stream and compared pixel by
+    pixel with the original bitmap before the output is written, use --check
+    to only run that comparison.
+
+'''
+
+import sys
+import re
+import argparse
+import os
+
+debug = None
+
+def debugOut(s):
+    if debug:
+        print(s)
+
+# look at arguments
+parser = argparse.ArgumentParser(description="Convert a GFX free font header to an RLE encoded free font")
+parser.add_argument("-v", "--verbose", help="debug output", action="store_true")
+parser.add_argument("input", help="input font header")
+parser.add_argument("-o", "--output", help="output file name")
+parser.add_argument("-n", "--name", help="name of the generated font (default: input font name + RLE)")
+parser.add_argument("-c", "--chars", help="only encode these characters, the others get an empty glyph")
+parser.add_argument("--check", help="only check that every glyph survives the RLE round trip", action="store_true")
+args = parser.parse_args()
+
+if not os.path.exists(args.input):
+    parser.print_help()
+    print("The input file {} does not exist".format(args.input))
+    sys.exit(1)
+
+debug = args.verbose
+
+MAX_RUNS = 15    # Foreground runs per row, 4 bits in the row group header
+MAX_REPEAT = 16  # Rows per row group, 4 bits in the row group header
+MAX_BYTE = 255
+
+def parseFont(text):
+    '''Returns (name, bitmap bytes, glyph list, first, last, yAdvance)'''
+    m = re.search(r"const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError("no bitmap array found")
+    bitmap = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", re.sub(r"//.*", "", m.group(2)))]
+
+    m = re.search(r"const\s+GFXglyph\s+(\w+)\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError("no glyph array found")
+    glyphs = []
+    for g in re.findall(r"\{([^{}]*)\}", re.sub(r"//.*", "", m.group(2))):
+        offset, width, height, xAdvance, xOffset, yOffset = [int(v, 0) for v in g.split(",")]
+        glyphs.append([offset, width, height, xAdvance, xOffset, yOffset])
+
+    m = re.search(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        raise ValueError("no GFXfont definition found")
+    fields = [f.strip() for f in re.sub(r"\([^)]*\)", "", m.group(2)).split(",")]
+    first, last, yAdvance = [int(v, 0) for v in fields[2:5]]
+    if last - first + 1 != len(glyphs):
+        raise ValueError("glyph count {} does not match range 0x{:02X}-0x{:02X}".format(len(glyphs), first, last))
+    return m.group(1), bitmap, glyphs, first, last, yAdvance
+
+def glyphPixels(bitmap, glyph):
+    '''Expands a 1 bit per pixel glyph bitmap into rows of 0/1, as drawChar() reads it'''
+    offset, w, h = glyph[0], glyph[1], glyph[2]
+    rows = []
+    bit = 0
+    for y in range(h):
+        row = []
+        for x in range(w):
+            row.append((bitmap[offset + (bit >> 3)] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        rows.append(row)
+    return rows
+
+def rowRuns(row):
+    '''Returns the row as a list of (skip, length) foreground runs'''
+    runs = []
+    x = 0
+    start = 0
+    while x < len(row):
+        if row[x]:
+            run = x
+            while x < len(row) and row[x] and x - run < MAX_BYTE:
+                x += 1
+            runs.append((run - start, x - run))
+            start = x
+        else:
+            x += 1
+    return runs
+
+def encodeGlyph(rows):
+    '''Encodes glyph rows as RLE row groups'''
+    out = []
+    y = 0
+    while y < len(rows):
+        runs = rowRuns(rows[y])
+        if len(runs) > MAX_RUNS:
+            raise ValueError("row has {} runs, the RLE format allows {}".format(len(runs), MAX_RUNS))
+        repeat = 1
+        while y + repeat < len(rows) and repeat < MAX_REPEAT and rows[y + repeat] == rows[y]:
+            repeat += 1
+        out.append(((repeat - 1) << 4) | len(runs))
+        for skip, length in runs:
+            out += [skip, length]
+        y += repeat
+    return out
+
+def decodeGlyph(data, offset, w, h):
+    '''Renders an RLE glyph the same way TFT_eSPI::drawCharRLE() does'''
+    rows = [[0] * w for y in range(h)]
+    y = 0
+    while y < h:
+        header = data[offset]
+        offset += 1
+        repeat = (header >> 4) + 1
+        x = 0
+        for n in range(header & 0x0F):
+            x += data[offset]
+            length = data[offset + 1]
+            offset += 2
+            for yy in range(y, y + repeat):
+                for xx in range(x, x + length):
+                    rows[yy][xx] = 1
+            x += length
+        y += repeat
+    return rows
+
+try:
+    infile = open(args.input, "r")
+    name, bitmap, glyphs, first, last, yAdvance = parseFont(infile.read())
+    infile.close()
+except (IOError, ValueError) as e:
+    print("could not read font from {}: {}".format(args.input, e))
+    sys.exit(1)
+
+debugOut("Font {}: 0x{:02X}-0x{:02X}, {} bitmap bytes".format(name, first, last, len(bitmap)))
+
+# Optionally keep only the characters actually used, trimming the code range to them
+if args.chars:
+    wanted = set(ord(c) for c in args.chars if first <= ord(c) <= last)
+    if not wanted:
+        print("none of the requested characters are in the font")
+        sys.exit(1)
+    newFirst, newLast = min(wanted), max(wanted)
+    glyphs = glyphs[newFirst - first:newLast - first + 1]
+    for c in range(newFirst, newLast + 1):
+        if c not in wanted:
+            glyph = glyphs[c - newFirst]
+            glyph[1] = glyph[2] = glyph[4] = glyph[5] = 0 # Keep xAdvance only
+    first, last = newFirst, newLast
+
+# Encode every glyph, then render both versions and compare the pixels
+rle = []
+rleGlyphs = []
+for i, glyph in enumerate(glyphs):
+    rows = glyphPixels(bitmap, glyph)
+    try:
+        data = encodeGlyph(rows)
+    except ValueError as e:
+        print("glyph 0x{:02X}: {}".format(first + i, e))
+        sys.exit(1)
+    rleGlyphs.append([len(rle)] + glyph[1:])
+    rle += data
+    debugOut("0x{:02X}: {}x{} {} -> {} bytes".format(first + i, glyph[1], glyph[2], (glyph[1] * glyph[2] + 7) // 8, len(data)))
+
+errors = 0
+for i, glyph in enumerate(glyphs):
+    if glyphPixels(bitmap, glyph) != decodeGlyph(rle, rleGlyphs[i][0], glyph[1], glyph[2]):
+        print("glyph 0x{:02X} does not match after RLE round trip".format(first + i))
+        errors += 1
+if errors:
+    sys.exit(1)
+
+bitmapBytes = sum((g[1] * g[2] + 7) // 8 for g in glyphs)
+print("{} glyphs checked, bitmaps {} -> {} bytes".format(len(glyphs), bitmapBytes, len(rle)))
+if args.check:
+    sys.exit(0)
+
+if args.name == None:
+    rleName = name + "RLE"
+else:
+    rleName = args.name
+
+if args.output == None:
+    output = os.path.splitext(os.path.basename(args.input))[0] + "RLE.h"
+else:
+    output = args.output
+
+outputString = "// Generated by TFT_eSPI Tools/gfxff2rle from " + os.path.basename(args.input) + '\n'
+outputString += "// Run-length encoded free font, select it with setFreeFontRLE(&" + rleName + ")\n\n"
+outputString += "const uint8_t " + rleName + "Bitmaps[] PROGMEM = {\n"
+lines = []
+for i in range(0, len(rle), 12):
+    lines.append("  " + ", ".join("0x{:02X}".format(b) for b in rle[i:i + 12]))
+outputString += ",\n".join(lines) + " };\n\n"
+
+outputString += "const GFXglyph " + rleName + "Glyphs[] PROGMEM = {\n"
+for i, g in enumerate(rleGlyphs):
+    c = first + i
+    outputString += "  {{ {:5d}, {:3d}, {:3d}, {:3d}, {:4d}, {:4d} }}".format(*g)
+    outputString += (",   " if i < len(rleGlyphs) - 1 else " }; ")
+    outputString += "// 0x{:02X}".format(c) + (" '{}'".format(chr(c)) if 32 < c < 127 else "") + '\n'
+
+outputString += "\nconst GFXrlefont " + rleName + " PROGMEM = {\n"
+outputString += "  (uint8_t  *)" + rleName + "Bitmaps,\n"
+outputString += "  (GFXglyph *)" + rleName + "Glyphs,\n"
+outputString += "  0x{:02X}, 0x{:02X}, {} }};\n\n".format(first, last, yAdvance)
+outputString += "// Approx. {} bytes\n".format(len(rle) + len(rleGlyphs) * 7 + 7)
+
+outfile = open(output, "w")
+outfile.write(outputString)
+outfile.close()
+print("written {}".format(output))
@@ -0,0 +1,200 @@
+/*
+  Host conformance test for the run-length encoded free fonts.
+
+  TFT_eSPI::drawChar() and TFT_eSPI::drawCharRLE() are copied verbatim out of
+  TFT_eSPI.cpp by the Makefile and built against the minimal TFT_eSPI class
+  below, which draws into a frame buffer instead of a display. Every glyph of
+  FONT is then drawn from its bitmap and from its RLE version (RLE_FONT, made
+  by gfxff2rle.py) and the frame buffers are compared pixel by pixel:
+
+    - transparent, size 1 and 2 (drawCharRLE() against the bitmap path)
+    - opaque, size 1 (the single address window paths, the window must be
+      filled exactly)
+    - opaque, size 2 and clipped by the viewport (cell fill, then transparent)
+
+  Build and run with "make", see the Makefile for the fonts checked.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uintptr_t *)(addr)) // Only used to read pointers
+
+#include <Fonts/GFXFF/gfxfont.h>
+
+#ifdef FONT_HEADER
+  #include FONT_HEADER
+#endif
+#include RLE_HEADER
+
+#define FB_W 512
+#define FB_H 512
+
+#define FG_COLOR 0xFFFF
+#define BG_COLOR 0x1234
+#define FB_CLEAR 0x0000
+
+// The members of TFT_eSPI used by drawChar() and drawCharRLE(), drawing into a frame buffer
+class TFT_eSPI {
+ public:
+  TFT_eSPI() { reset(); }
+
+  void reset() {
+    for (int32_t i = 0; i < FB_W * FB_H; i++) fb[i] = FB_CLEAR;
+    _vpX = 0; _vpY = 0; _vpW = FB_W; _vpH = FB_H;
+    _xDatum = 0; _yDatum = 0;
+    _vpOoB = false;
+    inTransaction = lockTransaction = false;
+    winActive = false;
+    errors = 0;
+  }
+
+  // Selects the font, glyph_ab and glyph_bb are given so that both fonts of a pair get the same cell
+  void setFont(const GFXfont *f, bool rle, uint8_t ab, uint8_t bb) {
+    gfxFont = (GFXfont *)f;
+    _gfxRLE = rle;
+    glyph_ab = ab;
+    glyph_bb = bb;
+  }
+
+  void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+  void drawCharRLE(int32_t x, int32_t y, const uint8_t *rle, uint8_t h, int8_t xo, int8_t yo, uint32_t color, uint8_t size);
+
+  void begin_tft_write() {}
+
+  void end_tft_write() {
+    if (winActive && winPushed != (winX1 - winX0 + 1) * (winY1 - winY0 + 1)) {
+      printf("  window %dx%d received %d pixels\n", winX1 - winX0 + 1, winY1 - winY0 + 1, winPushed);
+      errors++;
+    }
+    winActive = false;
+  }
+
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    winX0 = x0; winY0 = y0; winX1 = x1; winY1 = y1;
+    winPushed = 0;
+    winActive = true;
+  }
+
+  void pushBlock(uint16_t color, uint32_t len) {
+    int32_t w = winX1 - winX0 + 1;
+    while (len--) {
+      int32_t x = winX0 + winPushed % w;
+      int32_t y = winY0 + winPushed / w;
+      if (y > winY1) {
+        printf("  pushBlock() past the end of the window\n");
+        errors++;
+        return;
+      }
+      setPixel(x, y, color);
+      winPushed++;
+    }
+  }
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) {
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return;
+    setPixel(x, y, color);
+  }
+
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    for (int32_t yy = y; yy < y + h; yy++)
+      for (int32_t xx = x; xx < x + w; xx++) drawPixel(xx, yy, color);
+  }
+
+  uint16_t fb[FB_W * FB_H];
+  int      errors;
+
+  int32_t  _vpX, _vpY, _vpW, _vpH;
+  int32_t  _xDatum, _yDatum;
+  bool     _vpOoB;
+  bool     inTransaction, lockTransaction;
+
+  GFXfont *gfxFont;
+  bool     _gfxRLE;
+  bool     _fillbg;
+  uint8_t  glyph_ab, glyph_bb;
+
+ private:
+  void setPixel(int32_t x, int32_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= FB_W || y >= FB_H) return;
+    fb[x + y * FB_W] = color;
+  }
+
+  bool     winActive;
+  int32_t  winX0, winY0, winX1, winY1, winPushed;
+};
+
+#include "TFT_eSPI_drawChar.inc"
+
+static TFT_eSPI bitmapTft, rleTft;
+
+// Same as setFreeFont(), for the glyphs of the RLE font only
+static void cellMetrics(const GFXfont *f, uint8_t &ab, uint8_t &bb) {
+  ab = 0;
+  bb = 0;
+  for (uint16_t c = 0; c <= f->last - f->first; c++) {
+    int8_t a = -f->glyph[c].yOffset;
+    if (a > ab) ab = a;
+    int8_t b = f->glyph[c].height - a;
+    if (b > bb) bb = b;
+  }
+}
+
+// Draws c in both fonts and compares the frame buffers, returns true if they are identical
+static bool compare(const char *mode, uint16_t c, bool fillbg, uint8_t size, int32_t vpH) {
+  const GFXfont *rleFont = (const GFXfont *)&RLE_FONT;
+  uint8_t ab, bb;
+  cellMetrics(rleFont, ab, bb);
+
+  TFT_eSPI *tfts[2] = { &bitmapTft, &rleTft };
+  for (int i = 0; i < 2; i++) {
+    TFT_eSPI &tft = *tfts[i];
+    tft.reset();
+    tft._vpH = vpH;
+    tft._fillbg = fillbg;
+    if (i == 0) tft.setFont(&FONT, false, ab, bb);
+    else tft.setFont(rleFont, true, ab, bb);
+    tft.drawChar(FB_W / 4, FB_H * 3 / 4, c, FG_COLOR, BG_COLOR, size);
+  }
+
+  if (bitmapTft.errors || rleTft.errors) {
+    printf("glyph 0x%02X %s: %d bitmap and %d RLE window errors\n", c, mode, bitmapTft.errors, rleTft.errors);
+    return false;
+  }
+  for (int32_t i = 0; i < FB_W * FB_H; i++) {
+    if (bitmapTft.fb[i] != rleTft.fb[i]) {
+      printf("glyph 0x%02X %s: first difference at %d,%d\n", c, mode, (int)(i % FB_W), (int)(i / FB_W));
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  const GFXfont *rleFont = (const GFXfont *)&RLE_FONT;
+  int glyphs = 0, failures = 0;
+
+  for (uint16_t c = rleFont->first; c <= rleFont->last; c++) {
+    // Codes dropped by gfxff2rle -c keep their xAdvance only
+    if (rleFont->glyph[c - rleFont->first].width == 0) continue;
+    glyphs++;
+    failures += !compare("transparent", c, false, 1, FB_H);
+    failures += !compare("transparent size 2", c, false, 2, FB_H);
+    failures += !compare("opaque", c, true, 1, FB_H);
+    failures += !compare("opaque size 2", c, true, 2, FB_H);
+    failures += !compare("opaque clipped", c, true, 1, FB_H * 3 / 4 - 4);
+  }
+
+  printf("%s: %d glyphs, %d renders, %d differ\n", RLE_HEADER, glyphs, glyphs * 5, failures);
+  return (failures || glyphs == 0) ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+/*
+  Opaque smooth font text drawn through the 32 level colour ramp of
+  drawGlyph(), against the per-pixel alphaBlend() path.
+
+  The same text is drawn with each example font loaded from a file without
+  the glyph cache (bitmap read row by row, so the per-pixel path), then from
+  a font array and from the file with the glyph cache (both on the ramp path).
+  The ramp renders must match each other exactly, and the per-pixel render
+  within the ramp quantisation: no colour channel may differ by more than
+  alphaBlend() itself changes over the 8 alpha values of one ramp level.
+  A glyph is a single memory write if and only if its bitmap lies inside its
+  character cell, other glyphs (the "1" of Final-Frontier-28 rises above the
+  ascent) keep the per-pixel path.
+
+  Text clipped by the viewport must take the per-pixel path.
+*/
+
+#include "host_test.h"
+
+#define TEXT_X 8
+#define TEXT_Y 40
+#define AREA_W 304
+#define AREA_H 80
+
+static const char *text = "12:34:56 0123456789 Hello";
+
+struct Colors {
+  uint16_t fg, bg;
+};
+
+static const Colors colors[] = {
+  { TFT_WHITE,  TFT_BLACK },
+  { TFT_BLACK,  TFT_WHITE },
+  { TFT_YELLOW, TFT_NAVY },
+  { 0x07E0,     0xF81F },
+  { 0x1234,     0x4321 },
+};
+
+static TFT_eSPI tft;
+
+static std::vector<uint16_t> grab(int32_t x, int32_t y, int32_t w, int32_t h) {
+  std::vector<uint16_t> area;
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++) area.push_back(panelPixel(x + i, y + j));
+  return area;
+}
+
+// Draws the text on a cleared panel, returns the area and the memory writes used
+static std::vector<uint16_t> render(const Colors &c, uint32_t *ramwr) {
+  panelClear(0xAAAA);
+  panelResetCounts();
+  tft.setTextColor(c.fg, c.bg, true);
+  tft.drawString(text, TEXT_X, TEXT_Y);
+  if (ramwr) *ramwr = panelCounts.ramwr;
+  return grab(0, 0, AREA_W + 2 * TEXT_X, AREA_H + TEXT_Y);
+}
+
+// Largest channel difference between alphaBlend() of an alpha value and of its ramp level
+static void rampError(uint16_t fg, uint16_t bg, int err[3]) {
+  err[0] = err[1] = err[2] = 0;
+  for (int a = 0; a < 256; a++) {
+    int n = a >> 3;
+    uint16_t exact = tft.alphaBlend(a, fg, bg);
+    uint16_t level = (a == 0xFF) ? fg : tft.alphaBlend((n << 3) | (n >> 2), fg, bg);
+    int d[3] = { abs((exact >> 11) - (level >> 11)), abs(((exact >> 5) & 0x3F) - ((level >> 5) & 0x3F)),
+                 abs((exact & 0x1F) - (level & 0x1F)) };
+    for (int i = 0; i < 3; i++) err[i] = max(err[i], d[i]);
+  }
+}
+
+static void compareRamp(const char *font, const Colors &c, const std::vector<uint16_t> &perPixel,
+                        const std::vector<uint16_t> &ramp) {
+  int err[3];
+  rampError(c.fg, c.bg, err);
+  int32_t w = AREA_W + 2 * TEXT_X;
+  for (size_t i = 0; i < ramp.size(); i++) {
+    uint16_t a = perPixel[i], b = ramp[i];
+    bool ok = abs((a >> 11) - (b >> 11)) <= err[0] && abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F)) <= err[1] &&
+              abs((a & 0x1F) - (b & 0x1F)) <= err[2];
+    // Solid foreground and background are never quantised
+    if (a == c.fg || a == c.bg) ok = ok && b == a;
+    if (!CHECK(ok, "%s %04X on %04X: pixel %d,%d is 0x%04X, per-pixel path 0x%04X", font, c.fg, c.bg,
+               (int)(i % w), (int)(i / w), b, a)) return;
+  }
+}
+
+// True if the glyph bitmap of code lies inside its cell, drawn at the left of the screen
+static bool insideCell(uint16_t code) {
+  uint16_t g;
+  if (!tft.getUnicodeIndex(code, &g)) return false;
+  return tft.gdX[g] >= 0 && tft.gdX[g] + tft.gWidth[g] <= tft.gxAdvance[g] &&
+         tft.gdY[g] <= tft.gFont.maxAscent && tft.gFont.maxAscent - tft.gdY[g] + tft.gHeight[g] <= tft.gFont.yAdvance;
+}
+
+// Each glyph alone, a single memory write on the ramp path, more on the per-pixel path
+static void checkPaths(const char *font) {
+  tft.setTextColor(TFT_WHITE, TFT_BLACK, true);
+  for (const char *p = text; *p; p++) {
+    if (*p == ' ') continue;
+    char s[2] = { *p, 0 };
+    panelResetCounts();
+    tft.drawString(s, TEXT_X, TEXT_Y);
+    if (insideCell(*p)) CHECK(panelCounts.ramwr == 1, "%s: '%c' used %u memory writes", font, *p, panelCounts.ramwr);
+    else CHECK(panelCounts.ramwr > 1, "%s: '%c' outside its cell used one memory write", font, *p);
+  }
+}
+
+struct FontFile {
+  const char *dir;
+  const char *name;
+};
+
+static const FontFile fontFiles[] = {
+  { FONT_DIR_DEMO,    "NotoSansBold15" },
+  { FONT_DIR_DEMO,    "NotoSansBold36" },
+  { FONT_DIR_DEMO,    "NotoSansMonoSCB20" },
+  { FONT_DIR_UNICODE, "Final-Frontier-28" },
+};
+
+int main(int argc, char **argv) {
+  tft.init();
+  tft.setRotation(1);
+
+  if (benchmarks(argc, argv)) printf("%-18s %12s %12s %12s %12s\n", "font", "bytes", "ramp bytes", "us", "ramp us");
+
+  for (const FontFile &f : fontFiles) {
+    fs::FS dir(f.dir);
+    std::vector<uint8_t> array = readFile(std::string(f.dir) + "/" + f.name + ".vlw");
+
+    tft.loadFont(array.data());
+    checkPaths(f.name);
+    tft.loadFont(f.name, dir);
+    tft.setGlyphCache(16384);
+    checkPaths(f.name);
+    tft.setGlyphCache(0);
+
+    for (const Colors &c : colors) {
+      uint32_t ramwr, rampRamwr;
+
+      tft.loadFont(f.name, dir);
+      tft.setGlyphCache(0);
+      std::vector<uint16_t> perPixel = render(c, &ramwr);
+
+      tft.loadFont(array.data());
+      std::vector<uint16_t> ramp = render(c, &rampRamwr);
+      CHECK(rampRamwr < ramwr, "%s: array font used %u memory writes, the per-pixel path %u", f.name, rampRamwr, ramwr);
+      compareRamp(f.name, c, perPixel, ramp);
+
+      tft.loadFont(f.name, dir);
+      tft.setGlyphCache(16384);
+      std::vector<uint16_t> cached = render(c, &ramwr);
+      CHECK(ramwr == rampRamwr, "%s: cached font used %u memory writes, array font %u", f.name, ramwr, rampRamwr);
+      CHECK(cached == ramp, "%s %04X on %04X: cached and array fonts differ", f.name, c.fg, c.bg);
+      tft.setGlyphCache(0);
+
+      // Clipped through the middle of the text, the per-pixel path must give the same pixels
+      tft.loadFont(array.data());
+      panelClear(0xAAAA);
+      tft.setViewport(0, 0, AREA_W / 2 + TEXT_X, TEXT_Y + tft.fontHeight() / 2, false);
+      tft.setTextColor(c.fg, c.bg, true);
+      tft.drawString(text, TEXT_X, TEXT_Y);
+      tft.resetViewport();
+      std::vector<uint16_t> clip = perPixel;
+      int32_t w = AREA_W + 2 * TEXT_X;
+      for (size_t i = 0; i < clip.size(); i++)
+        if ((int32_t)(i % w) >= AREA_W / 2 + TEXT_X || (int32_t)(i / w) >= TEXT_Y + tft.fontHeight() / 2) clip[i] = 0xAAAA;
+      CHECK(grab(0, 0, w, AREA_H + TEXT_Y) == clip, "%s %04X on %04X: clipped text differs from the per-pixel path",
+            f.name, c.fg, c.bg);
+    }
+
+    if (benchmarks(argc, argv)) {
+      uint32_t bytes, rampBytes;
+      tft.setTextColor(TFT_WHITE, TFT_BLACK, true);
+
+      // Per-pixel path from an array font, using a getColor callback that returns the background
+      tft.loadFont(array.data());
+      tft.setCallback([](uint16_t, uint16_t) -> uint16_t { return TFT_BLACK; });
+      panelResetCounts();
+      tft.drawString(text, TEXT_X, TEXT_Y);
+      bytes = panelCounts.bytes;
+      double us = nsPerCall([]() { tft.drawString(text, TEXT_X, TEXT_Y); }) / 1000;
+
+      tft.setCallback(nullptr);
+      panelResetCounts();
+      tft.drawString(text, TEXT_X, TEXT_Y);
+      rampBytes = panelCounts.bytes;
+      double rampUs = nsPerCall([]() { tft.drawString(text, TEXT_X, TEXT_Y); }) / 1000;
+
+      printf("%-18s %12u %12u %12.1f %12.1f\n", f.name, bytes, rampBytes, us, rampUs);
+    }
+    tft.unloadFont();
+  }
+
+  CHECK(panelErrors() == 0, "%u panel bus errors", panelErrors());
+  return report("alpha_ramp");
+}
@@ -0,0 +1,232 @@
+/*
+  Opaque free font characters, setTextColor(fg, bg, true), with the 42pt
+  clock digit fonts of the sketch in their bitmap and RLE versions.
+
+  - unscaled and inside the viewport, a character must be sent as one
+    address window that is filled exactly once, with fewer bytes than the
+    old way of erasing the cell with fillRect() and drawing the glyph on top
+  - its pixels must be those of that fillRect() and transparent glyph
+  - scaled by 2 (drawn with the fillRect() fallback) it must be the unscaled
+    character with every pixel doubled
+  - clipped by each side of a viewport and by the screen edges (also the
+    fallback) it must be the visible part of the unclipped character
+
+  Nothing outside the character cell may change. "gfxff_opaque --bench"
+  also prints the address commands and bytes of each path for a digit.
+*/
+
+#include "host_test.h"
+
+#include "../../../../src/HB9IIU7seg42ptNormal.h"
+#include "../../../../src/HB9IIU7seg42ptItalic.h"
+#include "../../../../src/HB9IIU7seg42ptNormalRLE.h"
+#include "../../../../src/HB9IIU7seg42ptItalicRLE.h"
+
+#define FG_COLOR 0xFFE0
+#define BG_COLOR 0x0841
+#define BORDER   0x5555
+
+#define CHAR_X 60   // Datum of the unscaled characters
+#define CHAR_Y 120
+
+// Gives the tests the font ascent and descent used for the character cell
+class HostTFT : public TFT_eSPI {
+ public:
+  int32_t ascent(void)  { return glyph_ab; }
+  int32_t descent(void) { return glyph_bb; }
+};
+
+static HostTFT tft;
+
+struct Font {
+  const char    *name;
+  const GFXfont *font;
+  bool           rle;
+};
+
+static const Font fonts[] = {
+  { "Normal",     &digital_7__mono_42pt7b,                          false },
+  { "Italic",     &digital_7_monoitalic42pt7b,                      false },
+  { "Normal RLE", (const GFXfont *)&digital_7__mono_42pt7bRLE,      true  },
+  { "Italic RLE", (const GFXfont *)&digital_7_monoitalic42pt7bRLE,  true  },
+};
+
+// Character cell relative to the datum, as drawChar() paints it
+struct Cell {
+  int32_t x, y, w, h;
+};
+
+static Cell cellOf(const GFXfont *f, uint16_t c) {
+  const GFXglyph *g = &f->glyph[c - f->first];
+  int32_t x1 = (g->xOffset + g->width > g->xAdvance) ? g->xOffset + g->width : g->xAdvance;
+  int32_t y1 = (g->yOffset + g->height > tft.descent()) ? g->yOffset + g->height : tft.descent();
+  Cell cell;
+  cell.x = (g->xOffset < 0) ? g->xOffset : 0;
+  cell.y = (g->yOffset < -tft.ascent()) ? g->yOffset : -tft.ascent();
+  cell.w = x1 - cell.x;
+  cell.h = y1 - cell.y;
+  return cell;
+}
+
+static void selectFont(const Font &f) {
+  if (f.rle) tft.setFreeFontRLE((const GFXrlefont *)f.font);
+  else tft.setFreeFont(f.font);
+}
+
+static std::vector<uint16_t> grab(int32_t x, int32_t y, int32_t w, int32_t h) {
+  std::vector<uint16_t> area;
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++) area.push_back(panelPixel(x + i, y + j));
+  return area;
+}
+
+// Checks the whole panel, pixels inside the given area must match expected, all others BORDER
+static bool onlyArea(const char *what, int32_t x, int32_t y, int32_t w, int32_t h, const std::vector<uint16_t> &expected) {
+  for (int32_t j = 0; j < PANEL_H; j++)
+    for (int32_t i = 0; i < PANEL_W; i++) {
+      bool inside = i >= x && i < x + w && j >= y && j < y + h;
+      uint16_t want = inside ? expected[(i - x) + (j - y) * w] : BORDER;
+      if (panelPixel(i, j) != want)
+        return CHECK(false, "%s: pixel %d,%d is 0x%04X, expected 0x%04X", what, (int)i, (int)j, panelPixel(i, j), want);
+    }
+  return true;
+}
+
+// The old way, without an opaque mode: erase the cell, then draw the glyph transparently
+static void drawErased(const GFXfont *f, uint16_t c, int32_t x, int32_t y) {
+  Cell cell = cellOf(f, c);
+  tft.fillRect(x + cell.x, y + cell.y, cell.w, cell.h, BG_COLOR);
+  tft.setTextColor(FG_COLOR, BG_COLOR, false);
+  tft.drawChar(x, y, c, FG_COLOR, BG_COLOR, 1);
+}
+
+static void drawOpaque(uint16_t c, int32_t x, int32_t y, uint8_t size) {
+  tft.setTextColor(FG_COLOR, BG_COLOR, true);
+  tft.drawChar(x, y, c, FG_COLOR, BG_COLOR, size);
+}
+
+// One address window per unscaled character, filled exactly, and the erased cell pixels
+static void singleWindow(const Font &f, uint16_t c, const std::vector<uint16_t> &erased) {
+  Cell cell = cellOf(f.font, c);
+
+  panelClear(BORDER);
+  tft.fillRect(0, 0, 1, 1, BORDER); // Some other window first, the reference used the same cell
+  uint32_t errors = panelErrors();
+  panelResetCounts();
+  drawOpaque(c, CHAR_X, CHAR_Y, 1);
+  PanelCounts opaque = panelCounts;
+
+  CHECK(opaque.caset == 1 && opaque.paset == 1 && opaque.ramwr == 1,
+        "%s '%c': %u CASET, %u PASET and %u RAMWR for one window", f.name, c, opaque.caset, opaque.paset, opaque.ramwr);
+  CHECK(opaque.pixels == (uint32_t)(cell.w * cell.h),
+        "%s '%c': %u pixels written for a %d x %d cell", f.name, c, opaque.pixels, (int)cell.w, (int)cell.h);
+  CHECK(panelErrors() == errors, "%s '%c': pixels outside the window", f.name, c);
+
+  char what[48];
+  snprintf(what, sizeof(what), "%s '%c' opaque", f.name, c);
+  onlyArea(what, CHAR_X + cell.x, CHAR_Y + cell.y, cell.w, cell.h, erased);
+}
+
+// Size 2 through the fillRect() fallback must double every pixel of the unscaled character
+static void scaled(const Font &f, uint16_t c, const std::vector<uint16_t> &cellPixels) {
+  Cell cell = cellOf(f.font, c);
+  const int32_t x = 120 - cell.w, y = 160 - cell.y - cell.h; // Centred, 2 * cell fits the panel
+
+  std::vector<uint16_t> doubled;
+  for (int32_t j = 0; j < 2 * cell.h; j++)
+    for (int32_t i = 0; i < 2 * cell.w; i++) doubled.push_back(cellPixels[i / 2 + (j / 2) * cell.w]);
+
+  panelClear(BORDER);
+  drawOpaque(c, x, y, 2);
+
+  char what[48];
+  snprintf(what, sizeof(what), "%s '%c' size 2", f.name, c);
+  onlyArea(what, x + 2 * cell.x, y + 2 * cell.y, 2 * cell.w, 2 * cell.h, doubled);
+}
+
+// Clipped characters through the fillRect() fallback must be the visible part of the unclipped one
+static void clipped(const Font &f, uint16_t c, const std::vector<uint16_t> &cellPixels) {
+  Cell cell = cellOf(f.font, c);
+  const int32_t cx = CHAR_X + cell.x, cy = CHAR_Y + cell.y;
+
+  // Viewports cutting each side of the cell, then the screen edges
+  struct Clip { const char *side; int32_t vx, vy, vw, vh, dx, dy; };
+  const Clip clips[] = {
+    { "left",   cx + 7, 0, PANEL_W - cx - 7, PANEL_H,           0, 0 },
+    { "right",  0, 0, cx + cell.w - 5, PANEL_H,                 0, 0 },
+    { "top",    0, cy + 11, PANEL_W, PANEL_H - cy - 11,         0, 0 },
+    { "bottom", 0, 0, PANEL_W, cy + cell.h / 2,                 0, 0 },
+    { "screen left",   0, 0, PANEL_W, PANEL_H, -cx - 9, 0 },
+    { "screen bottom", 0, 0, PANEL_W, PANEL_H, 0, PANEL_H - cy - cell.h + 13 },
+  };
+
+  for (const Clip &clip : clips) {
+    std::vector<uint16_t> expected;
+    int32_t x0 = cx + clip.dx, y0 = cy + clip.dy;
+    int32_t vx1 = clip.vx + clip.vw, vy1 = clip.vy + clip.vh;
+    for (int32_t j = 0; j < PANEL_H; j++)
+      for (int32_t i = 0; i < PANEL_W; i++) {
+        bool inside = i >= x0 && i < x0 + cell.w && j >= y0 && j < y0 + cell.h &&
+                      i >= clip.vx && i < vx1 && j >= clip.vy && j < vy1;
+        expected.push_back(inside ? cellPixels[(i - x0) + (j - y0) * cell.w] : BORDER);
+      }
+
+    panelClear(BORDER);
+    tft.setViewport(clip.vx, clip.vy, clip.vw, clip.vh, false);
+    drawOpaque(c, CHAR_X + clip.dx, CHAR_Y + clip.dy, 1);
+    tft.resetViewport();
+
+    char what[64];
+    snprintf(what, sizeof(what), "%s '%c' clipped %s", f.name, c, clip.side);
+    onlyArea(what, 0, 0, PANEL_W, PANEL_H, expected);
+  }
+}
+
+// Address commands and bytes of the old erase and draw, and of the opaque window, for a digit
+static void countDigit(const Font &f, uint16_t c, bool bench) {
+  panelClear(BORDER);
+  tft.fillRect(0, 0, 1, 1, BORDER); // Some other window first
+  panelResetCounts();
+  drawErased(f.font, c, CHAR_X, CHAR_Y);
+  PanelCounts erased = panelCounts;
+
+  tft.fillRect(0, 0, 1, 1, BORDER);
+  panelResetCounts();
+  drawOpaque(c, CHAR_X, CHAR_Y, 1);
+  PanelCounts opaque = panelCounts;
+
+  CHECK(opaque.bytes < erased.bytes, "%s '%c': %u bytes opaque, %u erased and drawn", f.name, c, opaque.bytes, erased.bytes);
+  if (!bench) return;
+  printf("%-12s '%c' %-16s %6u %6u %6u %8u\n", f.name, c, "erase + draw", erased.caset, erased.paset, erased.ramwr, erased.bytes);
+  printf("%-12s '%c' %-16s %6u %6u %6u %8u\n", f.name, c, "opaque window", opaque.caset, opaque.paset, opaque.ramwr, opaque.bytes);
+}
+
+int main(int argc, char **argv) {
+  bool bench = benchmarks(argc, argv);
+  tft.init();
+
+  if (bench) printf("%-21s %-16s %6s %6s %6s %8s\n", "gfxff_opaque", "", "CASET", "PASET", "RAMWR", "bytes");
+
+  int glyphs = 0;
+  for (const Font &f : fonts) {
+    selectFont(f);
+    for (uint16_t c = f.font->first; c <= f.font->last; c++) {
+      if (f.font->glyph[c - f.font->first].width == 0) continue;
+      glyphs++;
+      Cell cell = cellOf(f.font, c);
+
+      // The reference: the cell erased with fillRect() and the glyph drawn transparently
+      panelClear(BORDER);
+      drawErased(f.font, c, CHAR_X, CHAR_Y);
+      std::vector<uint16_t> erased = grab(CHAR_X + cell.x, CHAR_Y + cell.y, cell.w, cell.h);
+
+      singleWindow(f, c, erased);
+      scaled(f, c, erased);
+      clipped(f, c, erased);
+      if (c == '8') countDigit(f, c, bench);
+    }
+  }
+  CHECK(glyphs > 40, "only %d glyphs checked", glyphs);
+
+  return report("gfxff_opaque");
+}
@@ -0,0 +1,223 @@
+/*
+  The glyph cache of smooth fonts loaded from a file: setGlyphCache(),
+  getCachedGlyph() through drawGlyph(), getGlyphCacheStats().
+
+  A model of the cache (a least recently used list of glyph numbers and
+  sizes) follows a pseudo random sequence of glyphs, the statistics must
+  match it after each glyph and a hit must not touch the file. This checks
+  the eviction order, the byte budget, and the hits, misses, evictions,
+  bytes and glyph count. unloadFont() must empty the cache, glyphs bigger
+  than the budget are read row by row, and cached glyphs must draw the
+  same pixels as glyphs read from the file.
+
+  "glyph_cache --bench" also times a clock string with and without the cache.
+*/
+
+#include "host_test.h"
+
+#include <list>
+
+#define FONT "NotoSansBold36"
+
+static TFT_eSPI tft;
+static fs::FS   fonts(FONT_DIR_DEMO);
+
+static const char *chars = "0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+// Draws one character, transparent so that cached and file glyphs take the same path
+static void draw(char c) {
+  char s[2] = { c, 0 };
+  tft.setTextColor(TFT_WHITE);
+  tft.drawString(s, 20, 20);
+}
+
+static uint32_t bitmapSize(char c) {
+  uint16_t g = 0;
+  tft.getUnicodeIndex(c, &g);
+  return tft.gWidth[g] * tft.gHeight[g];
+}
+
+// The expected cache content, most recently used first
+struct Model {
+  std::list<char> lru;
+  uint32_t budget, overhead;
+  TFT_eSPI::glyphCacheStats stats;
+
+  // Returns true if c is a hit
+  bool draw(char c) {
+    for (std::list<char>::iterator i = lru.begin(); i != lru.end(); ++i)
+      if (*i == c) {
+        lru.erase(i);
+        lru.push_front(c);
+        stats.hits++;
+        return true;
+      }
+    stats.misses++;
+    uint32_t size = overhead + bitmapSize(c);
+    if (size > budget) return false;
+    while (!lru.empty() && stats.bytes + size > budget) {
+      stats.bytes -= overhead + bitmapSize(lru.back());
+      stats.glyphs--;
+      stats.evictions++;
+      lru.pop_back();
+    }
+    lru.push_front(c);
+    stats.bytes += size;
+    stats.glyphs++;
+    return false;
+  }
+};
+
+static bool sameStats(const char *what, const TFT_eSPI::glyphCacheStats &want) {
+  TFT_eSPI::glyphCacheStats got = tft.getGlyphCacheStats();
+  return CHECK(got.hits == want.hits && got.misses == want.misses && got.evictions == want.evictions &&
+               got.bytes == want.bytes && got.glyphs == want.glyphs,
+               "%s: hits %u misses %u evictions %u bytes %u glyphs %u, expected %u %u %u %u %u", what,
+               got.hits, got.misses, got.evictions, got.bytes, got.glyphs,
+               want.hits, want.misses, want.evictions, want.bytes, want.glyphs);
+}
+
+// Size of an entry header, found from the first glyph cached
+static uint32_t entryOverhead(void) {
+  tft.setGlyphCache(65536);
+  draw('A');
+  uint32_t overhead = tft.getGlyphCacheStats().bytes - bitmapSize('A');
+  CHECK(overhead > 0 && overhead <= 64, "entry overhead of %u bytes", overhead);
+  return overhead;
+}
+
+// Draws the sequence, checking the statistics and file accesses against the model
+static void followModel(const char *what, uint32_t budget, uint32_t overhead, const char *sequence) {
+  tft.setGlyphCache(budget);
+  Model model = { std::list<char>(), budget, overhead, { 0, 0, 0, 0, 0 } };
+  for (const char *p = sequence; *p; p++) {
+    uint32_t reads = fs::fileReads, seeks = fs::fileSeeks;
+    bool hit = model.draw(*p);
+    draw(*p);
+    if (!sameStats(what, model.stats)) return;
+    if (hit) {
+      if (!CHECK(fs::fileReads == reads && fs::fileSeeks == seeks, "%s: hit on '%c' accessed the file", what, *p)) return;
+    } else if (overhead + bitmapSize(*p) <= budget) {
+      if (!CHECK(fs::fileReads == reads + 1 && fs::fileSeeks == seeks + 1,
+                 "%s: miss on '%c' took %u reads and %u seeks", what, *p, fs::fileReads - reads, fs::fileSeeks - seeks)) return;
+    }
+    CHECK(tft.getGlyphCacheStats().bytes <= budget, "%s: %u bytes over the budget of %u", what,
+          tft.getGlyphCacheStats().bytes, budget);
+  }
+}
+
+static std::vector<uint16_t> grab(void) {
+  std::vector<uint16_t> area;
+  for (int32_t y = 0; y < 80; y++)
+    for (int32_t x = 0; x < 80; x++) area.push_back(panelPixel(x, y));
+  return area;
+}
+
+int main(int argc, char **argv) {
+  tft.init();
+  tft.setRotation(1);
+
+  tft.loadFont(FONT, fonts);
+  if (!CHECK(tft.fontLoaded, FONT " not loaded")) return report("glyph_cache");
+
+  uint32_t overhead = entryOverhead();
+
+  // Glyphs A, B and C, and a glyph D not bigger than B
+  char gb = 'A', gd = 'A';
+  for (const char *p = chars; *p; p++) {
+    if (*p == 'A' || *p == 'C') continue;
+    if (bitmapSize(*p) > bitmapSize(gb)) gb = *p;
+    if (gd == 'A' || bitmapSize(*p) < bitmapSize(gd)) gd = *p;
+  }
+  uint32_t a = overhead + bitmapSize('A'), b = overhead + bitmapSize(gb), c = overhead + bitmapSize('C');
+  uint32_t d = overhead + bitmapSize(gd);
+
+  // Off by default and with a zero budget, nothing is counted
+  tft.loadFont(FONT, fonts);
+  tft.setGlyphCache(0);
+  draw('A');
+  sameStats("no cache", { 0, 0, 0, 0, 0 });
+
+  // A, B and C fill the budget, A is used again so B is the oldest when D needs room
+  tft.setGlyphCache(a + b + c);
+  draw('A'); draw(gb); draw('C'); draw('A');
+  sameStats("A B C A", { 1, 3, 0, a + b + c, 3 });
+  draw(gd);
+  sameStats("D evicts B", { 1, 4, 1, a + c + d, 3 });
+  draw('A'); draw('C'); draw(gd);
+  sameStats("A C D are cached", { 4, 4, 1, a + c + d, 3 });
+  draw(gb);
+  TFT_eSPI::glyphCacheStats s = tft.getGlyphCacheStats();
+  CHECK(s.misses == 5, "B was not evicted");
+
+  // Random sequences with budgets from a few glyphs to all of them
+  std::string sequence;
+  srand(1);
+  for (int i = 0; i < 2000; i++) sequence += chars[rand() % strlen(chars)];
+  uint32_t all = 0;
+  for (const char *p = chars; *p; p++) all += overhead + bitmapSize(*p);
+  const uint32_t budgets[] = { c, 3 * c, 2000, 6000, all / 2, all };
+  for (uint32_t budget : budgets) {
+    char what[32];
+    snprintf(what, sizeof(what), "budget %u", budget);
+    followModel(what, budget, overhead, sequence.c_str());
+  }
+  CHECK(tft.getGlyphCacheStats().evictions == 0 && tft.getGlyphCacheStats().hits > 1900, "a budget for all glyphs evicts");
+
+  // A glyph bigger than the budget is a miss, read row by row and not cached
+  uint16_t g;
+  tft.getUnicodeIndex('W', &g);
+  tft.setGlyphCache(overhead + bitmapSize('W') - 1);
+  uint32_t reads = fs::fileReads;
+  draw('W');
+  CHECK(fs::fileReads - reads == tft.gHeight[g], "uncached W took %u reads for %u rows", fs::fileReads - reads, tft.gHeight[g]);
+  sameStats("too big", { 0, 1, 0, 0, 0 });
+
+  // unloadFont() empties the cache, a different font does not get the old glyphs
+  tft.setGlyphCache(65536);
+  draw('A'); draw('B'); draw('A');
+  tft.unloadFont();
+  sameStats("after unloadFont", { 1, 2, 0, 0, 0 });
+  tft.loadFont("NotoSansBold15", fonts);
+  draw('A');
+  sameStats("other font", { 1, 3, 0, overhead + bitmapSize('A'), 1 });
+
+  // Cached glyphs draw the same pixels as glyphs read from the file
+  for (int size = 0; size < 2; size++) {
+    tft.loadFont(size ? "NotoSansBold36" : "NotoSansBold15", fonts);
+    for (const char *p = chars; *p; p++) {
+      tft.setGlyphCache(0);
+      panelClear(TFT_BLACK);
+      draw(*p);
+      std::vector<uint16_t> file = grab();
+      tft.setGlyphCache(65536);
+      draw(*p);                          // Miss, drawn from the bitmap just read
+      std::vector<uint16_t> miss = grab();
+      panelClear(TFT_BLACK);
+      draw(*p);                          // Hit
+      CHECK(miss == file && grab() == file, "'%c' differs when cached", *p);
+    }
+  }
+
+  if (benchmarks(argc, argv)) {
+    tft.loadFont(FONT, fonts);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK, true);
+    printf("%-18s %10s %10s %10s\n", "12:34:56", "reads", "seeks", "us");
+    for (int cached = 0; cached < 2; cached++) {
+      tft.setGlyphCache(cached ? 8192 : 0);
+      tft.drawString("12:34:56", 20, 20);
+      uint32_t reads = fs::fileReads, seeks = fs::fileSeeks;
+      tft.drawString("12:34:56", 20, 20);
+      reads = fs::fileReads - reads;
+      seeks = fs::fileSeeks - seeks;
+      double us = nsPerCall([]() { tft.drawString("12:34:56", 20, 20); }) / 1000;
+      printf("%-18s %10u %10u %10.1f\n", cached ? "cache 8192 bytes" : "no cache", reads, seeks, us);
+    }
+    TFT_eSPI::glyphCacheStats s = tft.getGlyphCacheStats();
+    printf("cache: %u glyphs, %u bytes\n", s.glyphs, s.bytes);
+  }
+
+  tft.unloadFont();
+  CHECK(panelErrors() == 0, "%u panel bus errors", panelErrors());
+  return report("glyph_cache");
+}
@@ -0,0 +1,84 @@
+// Helpers shared by the TFT_eSPI host tests, see README.md
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <TFT_eSPI.h>
+
+#include <stdarg.h>
+
+#include <chrono>
+#include <vector>
+
+#include "shim/host_panel.h"
+
+// Example fonts used by the smooth font tests, relative to this directory
+#define FONT_DIR_DEMO    "../../examples/Smooth Fonts/SPIFFS/Font_Demo_3/data"
+#define FONT_DIR_UNICODE "../../examples/Smooth Fonts/SPIFFS/Unicode_test/data"
+
+static int failures = 0;
+
+// Counts and reports a failed check, returns the condition
+#define CHECK(cond, ...) check((cond), __FILE__, __LINE__, __VA_ARGS__)
+static bool check(bool ok, const char *file, int line, const char *fmt, ...) __attribute__((format(printf, 4, 5)));
+static bool check(bool ok, const char *file, int line, const char *fmt, ...) {
+  if (ok) return true;
+  va_list ap;
+  va_start(ap, fmt);
+  printf("%s:%d: ", file, line);
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+  failures++;
+  return false;
+}
+
+// Prints the result line and returns the exit code of the test
+static int report(const char *test) {
+  printf("%s: %s\n", test, failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
+
+// True if the test was started with --bench, benchmarks only run then
+static bool benchmarks(int argc, char **argv) {
+  return argc > 1 && !strcmp(argv[1], "--bench");
+}
+
+// Nanoseconds per call of f(), run for at least 100 ms
+template <typename F>
+static double nsPerCall(F f) {
+  typedef std::chrono::steady_clock clock;
+  uint32_t calls = 0;
+  clock::time_point start = clock::now();
+  double ns;
+  do {
+    for (int i = 0; i < 64; i++) f();
+    calls += 64;
+    ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+  } while (ns < 100e6);
+  return ns / calls;
+}
+
+// Reads a whole file, for loading fonts as arrays
+static std::vector<uint8_t> readFile(const std::string &path) {
+  std::vector<uint8_t> data;
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return data;
+  int c;
+  while ((c = fgetc(f)) != EOF) data.push_back(c);
+  fclose(f);
+  return data;
+}
+
+// Compares an area of the panel with an expected image, reports the first difference
+static bool samePixels(const char *what, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *expected) {
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++) {
+      uint16_t got = panelPixel(x + i, y + j), want = expected[i + j * w];
+      if (got != want)
+        return CHECK(false, "%s: pixel %d,%d is 0x%04X, expected 0x%04X", what, (int)(x + i), (int)(y + j), got, want);
+    }
+  return true;
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+  8-bit (RGB332) pushImage() through the rgb332_swapped[] table, against the
+  shift and mask conversion it replaced.
+
+  The table is extracted from TFT_eSPI.cpp by the Makefile and each entry is
+  compared with the old conversion. Then all 256 colours, and random images
+  of every width from 1 to 40 pixels, are pushed with the RAM, FLASH and
+  transparent pushImage() versions, with setSwapBytes() off and on and with
+  and without a colour map (ignored for 8-bit images), unclipped and clipped
+  on each side. The panel must show exactly the old colours.
+
+  "rgb332 --bench" also times the line expansion of both versions.
+*/
+
+#include "host_test.h"
+
+#include "rgb332_swapped.inc"
+
+// The old conversion of one line, bytes in display order
+static void oldExpand(uint16_t *lineBuf, const uint8_t *ptr, uint32_t len) {
+  uint8_t blue[] = {0, 11, 21, 31}; // blue 2 to 5-bit colour lookup table
+
+  int32_t _lastColor = -1; // Set to illegal value
+
+  // Used to store last shifted colour
+  uint8_t msbColor = 0;
+  uint8_t lsbColor = 0;
+
+  uint8_t* linePtr = (uint8_t*)lineBuf;
+
+  while(len--) {
+    int32_t color = *ptr++;
+
+    // Shifts are slow so check if colour has changed first
+    if (color != _lastColor) {
+      //          =====Green=====     ===============Red==============
+      msbColor = (color & 0x1C)>>2 | (color & 0xC0)>>3 | (color & 0xE0);
+      //          =====Green=====    =======Blue======
+      lsbColor = (color & 0x1C)<<3 | blue[color & 0x03];
+      _lastColor = color;
+    }
+
+    *linePtr++ = msbColor;
+    *linePtr++ = lsbColor;
+  }
+}
+
+// The new line expansion, as in pushImage()
+static void tableExpand(uint16_t *linePtr, const uint8_t *ptr, uint32_t len) {
+  while (len >= 4) {
+    linePtr[0] = pgm_read_word(&rgb332_swapped[ptr[0]]);
+    linePtr[1] = pgm_read_word(&rgb332_swapped[ptr[1]]);
+    linePtr[2] = pgm_read_word(&rgb332_swapped[ptr[2]]);
+    linePtr[3] = pgm_read_word(&rgb332_swapped[ptr[3]]);
+    ptr += 4;
+    linePtr += 4;
+    len -= 4;
+  }
+  while (len--) *linePtr++ = pgm_read_word(&rgb332_swapped[*ptr++]);
+}
+
+// The colour the old code sent for an RGB332 value
+static uint16_t oldColor(uint8_t c) {
+  uint8_t bytes[2];
+  oldExpand((uint16_t *)bytes, &c, 1);
+  return (bytes[0] << 8) | bytes[1];
+}
+
+static TFT_eSPI tft;
+static uint16_t cmap[16] = { 0x0F0F, 0xF0F0, 0x1234, 0x4321 };
+
+enum Version { RAM, FLASH, TRANSPARENT };
+static const char *versions[] = { "RAM", "FLASH", "transparent" };
+
+#define BORDER 0x5555
+
+// Pushes an image at 10,10 with a clipping viewport, checks the panel against the old colours
+static void pushAndCheck(const char *what, Version v, const std::vector<uint8_t> &image, int32_t w, int32_t h,
+                         int32_t vpX, int32_t vpY, int32_t vpW, int32_t vpH, uint8_t transp) {
+  for (int swap = 0; swap < 2; swap++)
+    for (int map = 0; map < 2; map++) {
+      panelClear(BORDER);
+      tft.setSwapBytes(swap);
+      tft.setViewport(vpX, vpY, vpW, vpH, false);
+      uint8_t *data = (uint8_t *)image.data();
+      uint16_t *colorMap = map ? cmap : nullptr;
+      if (v == RAM) tft.pushImage(10, 10, w, h, data, true, colorMap);
+      else if (v == FLASH) tft.pushImage(10, 10, w, h, (const uint8_t *)data, true, colorMap);
+      else tft.pushImage(10, 10, w, h, data, transp, true, colorMap);
+      tft.resetViewport();
+      if (!CHECK(tft.getSwapBytes() == (bool)swap, "%s %s: swap bytes not restored", what, versions[v])) return;
+
+      for (int32_t y = 0; y < h + 20; y++)
+        for (int32_t x = 0; x < w + 20; x++) {
+          int32_t ix = x - 10, iy = y - 10;
+          bool inside = ix >= 0 && iy >= 0 && ix < w && iy < h && x >= vpX && y >= vpY && x < vpX + vpW && y < vpY + vpH;
+          uint16_t want = BORDER;
+          if (inside && (v != TRANSPARENT || image[ix + iy * w] != transp)) want = oldColor(image[ix + iy * w]);
+          uint16_t got = panelPixel(x, y);
+          if (!CHECK(got == want, "%s %s swap %d cmap %d: pixel %d,%d is 0x%04X, expected 0x%04X", what,
+                     versions[v], swap, map, (int)x, (int)y, got, want)) return;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+  tft.init();
+  tft.setRotation(1);
+
+  // The table against the old conversion and color8to16()
+  for (int c = 0; c < 256; c++) {
+    uint16_t entry = pgm_read_word(&rgb332_swapped[c]);
+    uint16_t color = (entry << 8) | (entry >> 8);
+    CHECK(color == oldColor(c), "table entry 0x%02X is 0x%04X, old code 0x%04X", c, color, oldColor(c));
+    CHECK(color == tft.color8to16(c), "table entry 0x%02X is 0x%04X, color8to16() 0x%04X", c, color, tft.color8to16(c));
+  }
+
+  // All colours, as a 16 x 16 image, whole and clipped on each side
+  std::vector<uint8_t> all;
+  for (int c = 0; c < 256; c++) all.push_back(c);
+  for (int v = RAM; v <= TRANSPARENT; v++) {
+    pushAndCheck("all colours", (Version)v, all, 16, 16, 0, 0, 320, 240, 0xE3);
+    pushAndCheck("clipped left/top", (Version)v, all, 16, 16, 13, 15, 320, 240, 0xE3);
+    pushAndCheck("clipped right/bottom", (Version)v, all, 16, 16, 0, 0, 21, 19, 0xE3);
+  }
+
+  // Every transparent colour
+  for (int t = 0; t < 256; t++) pushAndCheck("all colours", TRANSPARENT, all, 16, 16, 0, 0, 320, 240, t);
+
+  // Random images of each width, so each length of the 4 pixel unrolled loop tail
+  srand(1);
+  for (int32_t w = 1; w <= 40; w++) {
+    std::vector<uint8_t> image;
+    for (int32_t i = 0; i < w * 3; i++) image.push_back(rand() % 8 ? rand() : 0xE3);
+    char what[32];
+    snprintf(what, sizeof(what), "random %d x 3", (int)w);
+    for (int v = RAM; v <= TRANSPARENT; v++) {
+      pushAndCheck(what, (Version)v, image, w, 3, 0, 0, 320, 240, 0xE3);
+      pushAndCheck(what, (Version)v, image, w, 3, 11, 11, 320, 240, 0xE3);
+    }
+  }
+
+  if (benchmarks(argc, argv)) {
+    // A line of the banner width, random and with runs of 8 equal pixels
+    std::vector<uint8_t> randomLine, runLine;
+    for (int i = 0; i < 310; i++) {
+      randomLine.push_back(rand());
+      runLine.push_back((i / 8) * 37);
+    }
+    uint16_t lineBuf[310];
+    printf("%-16s %12s %12s\n", "310 pixels", "old ns", "table ns");
+    for (int r = 0; r < 2; r++) {
+      const uint8_t *line = r ? runLine.data() : randomLine.data();
+      volatile uint16_t sink;
+      double oldNs = nsPerCall([&]() { oldExpand(lineBuf, line, 310); sink = lineBuf[line[0]]; });
+      double tableNs = nsPerCall([&]() { tableExpand(lineBuf, line, 310); sink = lineBuf[line[0]]; });
+      (void)sink;
+      printf("%-16s %12.1f %12.1f\n", r ? "runs of 8" : "random", oldNs, tableNs);
+    }
+  }
+
+  CHECK(panelErrors() == 0, "%u panel bus errors", panelErrors());
+  return report("rgb332");
+}
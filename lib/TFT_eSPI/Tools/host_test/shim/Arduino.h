@@ -0,0 +1,94 @@
+// Minimal Arduino API for building TFT_eSPI on a host, see ../README.md
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+#include <string>
+
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uintptr_t *)(addr)) // Only used to read pointers
+
+#define digitalPinToBitMask(pin) (1UL << ((pin) & 31))
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+// Pins and timing, implemented by the panel emulator (host_panel.cpp)
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t val);
+int      digitalRead(uint8_t pin);
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+void     yield(void);
+
+inline long random(long howsmall, long howbig) {
+  return howsmall >= howbig ? howsmall : howsmall + rand() % (howbig - howsmall);
+}
+inline long random(long howbig) { return random(0, howbig); }
+
+inline char *ltoa(long value, char *str, int base) {
+  snprintf(str, 34, base == 16 ? "%lx" : "%ld", value);
+  return str;
+}
+
+class String {
+ public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v, int base = DEC) { char b[34]; snprintf(b, sizeof(b), base == HEX ? "%x" : "%d", v); s_ = b; }
+
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return s_.length(); }
+  void toCharArray(char *buf, unsigned int size) const {
+    if (!size) return;
+    strncpy(buf, s_.c_str(), size - 1);
+    buf[size - 1] = 0;
+  }
+  String &operator+=(const String &o) { s_ += o.s_; return *this; }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+  friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.s_); }
+  friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+
+ private:
+  std::string s_;
+};
+
+#include <Print.h>
+
+// Serial output goes to stdout
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+#endif
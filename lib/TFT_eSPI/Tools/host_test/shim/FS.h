@@ -0,0 +1,62 @@
+// Minimal Arduino file system API for building TFT_eSPI on a host
+// An FS maps absolute paths to files below a host directory.
+
+#ifndef _HOST_FS_H_
+#define _HOST_FS_H_
+
+#include <Arduino.h>
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+// Every seek() and read() call is counted, see fileSeeks and fileReads
+extern uint32_t fileSeeks, fileReads;
+
+class File {
+ public:
+  File(FILE *f = nullptr) : f_(f) {}
+
+  operator bool() const { return f_ != nullptr; }
+
+  int read() {
+    fileReads++;
+    return fgetc(f_);
+  }
+  size_t read(uint8_t *buf, size_t size) {
+    fileReads++;
+    return fread(buf, 1, size, f_);
+  }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+    fileSeeks++;
+    return fseek(f_, pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+  }
+  void close() {
+    if (f_) fclose(f_);
+    f_ = nullptr;
+  }
+
+ private:
+  FILE *f_;
+};
+
+class FS {
+ public:
+  FS(const char *root = ".") : root_(root) {}
+
+  File open(const String &path, const char *mode = "r") {
+    return File(fopen((root_ + path.c_str()).c_str(), mode[0] == 'r' ? "rb" : "wb"));
+  }
+  bool exists(const String &path) {
+    FILE *f = fopen((root_ + path.c_str()).c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+  }
+
+ private:
+  std::string root_;
+};
+
+} // namespace fs
+
+#endif
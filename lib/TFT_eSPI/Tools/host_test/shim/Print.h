@@ -0,0 +1,34 @@
+// Minimal Arduino Print class for building TFT_eSPI on a host
+
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <Arduino.h>
+
+class Print {
+ public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size-- && write(*buffer++)) n++;
+    return n;
+  }
+  size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long n, int base = DEC) { char b[34]; snprintf(b, sizeof(b), base == HEX ? "%lX" : "%ld", n); return write(b); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned long n, int base = DEC) { return print((long)n, base); }
+  size_t print(double n, int digits = 2) { char b[40]; snprintf(b, sizeof(b), "%.*f", digits, n); return write(b); }
+
+  template <typename T>
+  size_t println(const T &v) { return print(v) + write("\n"); }
+  size_t println() { return write("\n"); }
+};
+
+#endif
@@ -0,0 +1,38 @@
+// Minimal Arduino SPI API for building TFT_eSPI on a host
+// The bytes go to the panel emulator (host_panel.cpp), which counts them.
+
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include <Arduino.h>
+
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+#define SPI_HAS_TRANSACTION
+
+class SPISettings {
+ public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+ public:
+  void begin() {}
+  void begin(int8_t, int8_t, int8_t, int8_t = -1) {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  void setFrequency(uint32_t) {}
+  void setHwCs(bool) {}
+
+  uint8_t  transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data) {
+    uint16_t hi = transfer(data >> 8);
+    return (hi << 8) | transfer(data & 0xFF);
+  }
+};
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,10 @@
+// The host SPIFFS reads the fonts from a directory, see SPIFFS.root()
+
+#ifndef _HOST_SPIFFS_H_
+#define _HOST_SPIFFS_H_
+
+#include <FS.h>
+
+extern fs::FS SPIFFS;
+
+#endif
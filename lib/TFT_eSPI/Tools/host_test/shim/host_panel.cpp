@@ -0,0 +1,178 @@
+// ILI9341 panel emulator and the Arduino runtime for the host tests, see host_panel.h
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <FS.h>
+#include <SPIFFS.h>
+#include <tft_setup.h>
+
+#include <chrono>
+
+#include "host_panel.h"
+
+HardwareSerial Serial;
+SPIClass       SPI;
+fs::FS         SPIFFS(".");
+
+namespace fs {
+  uint32_t fileSeeks, fileReads;
+}
+
+PanelCounts panelCounts;
+
+// ILI9341 commands and MADCTL bits
+#define CMD_SWRST  0x01
+#define CMD_CASET  0x2A
+#define CMD_PASET  0x2B
+#define CMD_RAMWR  0x2C
+#define CMD_RAMRD  0x2E
+#define CMD_MADCTL 0x36
+
+#define MAD_MY 0x80
+#define MAD_MX 0x40
+#define MAD_MV 0x20
+
+static uint16_t gram[PANEL_W * PANEL_H];
+
+static bool     dcData = true;
+static bool     csLow  = false;
+static uint8_t  command;
+static uint32_t param;      // Parameter bytes received since the command
+static uint8_t  paramBuf[4];
+static uint8_t  madctl;
+static uint16_t colStart, colEnd = PANEL_W - 1, pageStart, pageEnd = PANEL_H - 1;
+static uint16_t col, page;  // Next GRAM location for RAMWR and RAMRD
+static uint16_t pixelHi;
+static uint32_t errors;
+
+void panelResetCounts(void) {
+  memset(&panelCounts, 0, sizeof(panelCounts));
+}
+
+void panelClear(uint16_t color) {
+  for (uint32_t i = 0; i < PANEL_W * PANEL_H; i++) gram[i] = color;
+}
+
+uint32_t panelErrors(void) {
+  return errors;
+}
+
+uint16_t panelRaw(int32_t x, int32_t y) {
+  if (x < 0 || y < 0 || x >= PANEL_W || y >= PANEL_H) return 0;
+  return gram[x + y * PANEL_W];
+}
+
+// Maps a column/page address to the GRAM index, -1 outside the panel
+static int32_t gramIndex(int32_t c, int32_t p) {
+  int32_t x = c, y = p;
+  if (madctl & MAD_MV) { x = p; y = c; }
+  if (x < 0 || y < 0 || x >= PANEL_W || y >= PANEL_H) return -1;
+  if (madctl & MAD_MX) x = PANEL_W - 1 - x;
+  if (madctl & MAD_MY) y = PANEL_H - 1 - y;
+  return x + y * PANEL_W;
+}
+
+uint16_t panelPixel(int32_t x, int32_t y) {
+  int32_t i = gramIndex(x, y);
+  return i < 0 ? 0 : gram[i];
+}
+
+// Moves to the next location of the window, columns first
+static void advance(void) {
+  if (col < colEnd) { col++; return; }
+  col = colStart;
+  if (page < pageEnd) page++;
+  else page = pageStart;
+}
+
+static uint8_t data(uint8_t b) {
+  uint32_t n = param++;
+  switch (command) {
+    case CMD_CASET:
+    case CMD_PASET:
+      if (n < 4) paramBuf[n] = b;
+      if (n == 3) {
+        uint16_t s = (paramBuf[0] << 8) | paramBuf[1], e = (paramBuf[2] << 8) | paramBuf[3];
+        if (command == CMD_CASET) { colStart = s; colEnd = e; }
+        else { pageStart = s; pageEnd = e; }
+      }
+      return 0;
+    case CMD_MADCTL:
+      if (n == 0) madctl = b;
+      return 0;
+    case CMD_RAMWR: {
+      if (!(n & 1)) { pixelHi = b; return 0; }
+      int32_t i = gramIndex(col, page);
+      if (i < 0) errors++;
+      else gram[i] = (pixelHi << 8) | b;
+      panelCounts.pixels++;
+      advance();
+      return 0;
+    }
+    case CMD_RAMRD: {
+      // A dummy byte, then R, G and B with the colour in the top 6 bits
+      if (n == 0) return 0;
+      int32_t i = gramIndex(col, page);
+      uint16_t c = i < 0 ? 0 : gram[i];
+      uint8_t  v;
+      switch ((n - 1) % 3) {
+        case 0:  v = (c >> 8) & 0xF8; break;
+        case 1:  v = (c >> 3) & 0xFC; break;
+        default: v = (c << 3) & 0xF8; advance(); break;
+      }
+      return v;
+    }
+    default:
+      return 0;
+  }
+}
+
+uint8_t SPIClass::transfer(uint8_t b) {
+  panelCounts.bytes++;
+  if (!csLow) { errors++; return 0; }
+  if (dcData) return data(b);
+
+  panelCounts.commands++;
+  command = b;
+  param = 0;
+  switch (b) {
+    case CMD_CASET: panelCounts.caset++; break;
+    case CMD_PASET: panelCounts.paset++; break;
+    case CMD_RAMWR: panelCounts.ramwr++; col = colStart; page = pageStart; break;
+    case CMD_RAMRD: panelCounts.ramrd++; col = colStart; page = pageStart; break;
+    case CMD_SWRST: // Registers back to their reset values, GRAM is kept
+      colStart = pageStart = 0;
+      colEnd = PANEL_W - 1;
+      pageEnd = PANEL_H - 1;
+      madctl = 0;
+      break;
+  }
+  return 0;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin == TFT_DC) dcData = val;
+  else if (pin == TFT_CS) {
+    if (!csLow && !val) panelCounts.transactions++;
+    csLow = !val;
+  }
+}
+
+int digitalRead(uint8_t) { return 0; }
+
+static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+uint32_t millis(void) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t micros(void) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The panel needs no time to reset or wake up
+void delay(uint32_t) {}
+void delayMicroseconds(uint32_t) {}
+void yield(void) {}
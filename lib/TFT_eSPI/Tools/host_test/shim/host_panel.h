@@ -0,0 +1,41 @@
+// ILI9341 panel emulator for the host tests
+// Decodes the SPI bytes TFT_eSPI sends through the generic driver into a 240 x 320
+// GRAM and counts them, so that tests can compare what reaches the display.
+
+#ifndef _HOST_PANEL_H_
+#define _HOST_PANEL_H_
+
+#include <stdint.h>
+
+#define PANEL_W 240
+#define PANEL_H 320
+
+struct PanelCounts {
+  uint32_t bytes;        // All bytes on the bus, commands, parameters, pixels and reads
+  uint32_t commands;     // Command bytes (DC low)
+  uint32_t caset;        // Column address commands
+  uint32_t paset;        // Page (row) address commands
+  uint32_t ramwr;        // Memory write commands
+  uint32_t ramrd;        // Memory read commands
+  uint32_t pixels;       // Pixels written to GRAM
+  uint32_t transactions; // Chip select low edges
+};
+
+extern PanelCounts panelCounts;
+
+// Clears the counters
+void panelResetCounts(void);
+
+// Fills the whole GRAM with a colour
+void panelClear(uint16_t color);
+
+// Pixel at x,y of the current rotation (as set by MADCTL), 0 outside the screen
+uint16_t panelPixel(int32_t x, int32_t y);
+
+// Pixel at x,y of the GRAM itself, independent of the rotation
+uint16_t panelRaw(int32_t x, int32_t y);
+
+// Number of bus errors seen (pixels outside the window, data without a command)
+uint32_t panelErrors(void);
+
+#endif
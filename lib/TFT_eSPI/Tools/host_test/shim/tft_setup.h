@@ -0,0 +1,24 @@
+// TFT_eSPI setup for the host tests, picked up through __has_include(<tft_setup.h>)
+// Same display, bus and fonts as the CYD build, on the generic processor driver.
+
+#define ILI9341_2_DRIVER
+#define TFT_WIDTH  240
+#define TFT_HEIGHT 320
+
+#define TFT_CS   15
+#define TFT_DC   2
+#define TFT_RST  -1
+
+#define LOAD_GLCD
+#define LOAD_FONT2
+#define LOAD_GFXFF
+#define SMOOTH_FONT
+
+#define SPI_FREQUENCY 55000000
+
+#define DISABLE_ALL_LIBRARY_WARNINGS
+
+// The generic driver does not load a file system for the smooth fonts
+#include <FS.h>
+#include <SPIFFS.h>
+#define FONT_FS_AVAILABLE
@@ -0,0 +1,203 @@
+/*
+  1 bit per pixel images: expand1bpp() through pushImage() and pushSprite(),
+  TFT_eSprite::expandLines(), and the clipped top lines of 1-bit pushImage().
+
+  The banner of the sketch (a 310 x 30 sprite, Orbitron 10pt) is drawn into
+  a 1-bit and an 8-bit sprite at several scroll positions, both are pushed
+  to the panel and the pixels compared, whole and clipped by the screen
+  edges (so dx and dy not 0, and dx not a multiple of 8) and by a viewport.
+  The expandLines() bands pushed as 16-bit images, as the sketch does with
+  DMA, must give the same pixels. A 1-bit bitmap in FLASH and in RAM is
+  also pushed at every clipping offset and checked bit by bit.
+
+  "sprite_1bpp --bench" also times the expansion of the banner.
+*/
+
+#include "host_test.h"
+
+#include "../../../../src/HB9IIOrbitronMed10pt.h"
+
+#define BANNER_W      310
+#define BANNER_H      30
+#define BANNER_BAND_H 5
+
+#define BORDER 0x5555
+
+static TFT_eSPI    tft;
+static TFT_eSprite banner1(&tft), banner8(&tft);
+
+static const char *scrollText = "Geneva: 21.4 C, few clouds, wind 3.1 m/s NE, humidity 64%";
+
+static std::vector<uint16_t> grab(int32_t x, int32_t y, int32_t w, int32_t h) {
+  std::vector<uint16_t> area;
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++) area.push_back(panelPixel(x + i, y + j));
+  return area;
+}
+
+// The old per-pixel expansion of pushImage(), from the first visible line
+static uint16_t bitColor(const uint8_t *data, int32_t w, int32_t x, int32_t y, uint16_t fg, uint16_t bg) {
+  uint32_t ww = (w + 7) >> 3;
+  return (data[ww * y + (x >> 3)] & (0x80 >> (x & 0x7))) ? fg : bg;
+}
+
+static void drawBanner(int32_t textX) {
+  banner1.fillSprite(0);
+  banner1.setTextColor(1);
+  banner1.drawString(scrollText, textX, 0);
+
+  banner8.fillSprite(TFT_BLACK);
+  banner8.setTextColor(TFT_WHITE);
+  banner8.drawString(scrollText, textX, 0);
+}
+
+// Pushes both sprites at x,y and compares the screen
+static void compareSprites(const char *what, int32_t x, int32_t y) {
+  tft.setSwapBytes(true); // pushSprite() must not depend on it
+
+  panelClear(BORDER);
+  banner8.pushSprite(x, y);
+  std::vector<uint16_t> want = grab(0, 0, 320, 240);
+
+  panelClear(BORDER);
+  banner1.setBitmapColor(TFT_WHITE, TFT_BLACK);
+  banner1.pushSprite(x, y);
+  CHECK(grab(0, 0, 320, 240) == want, "%s at %d,%d: 1-bit and 8-bit sprites differ", what, (int)x, (int)y);
+
+  // Other colours just replace white and black
+  panelClear(BORDER);
+  banner1.setBitmapColor(TFT_ORANGE, TFT_NAVY);
+  banner1.pushSprite(x, y);
+  std::vector<uint16_t> got = grab(0, 0, 320, 240);
+  for (size_t i = 0; i < want.size(); i++) {
+    uint16_t c = want[i] == TFT_WHITE ? TFT_ORANGE : want[i] == TFT_BLACK ? TFT_NAVY : want[i];
+    if (!CHECK(got[i] == c, "%s at %d,%d: pixel %d,%d is 0x%04X in colour, expected 0x%04X", what, (int)x, (int)y,
+               (int)(i % 320), (int)(i / 320), got[i], c)) break;
+  }
+  tft.setSwapBytes(false);
+}
+
+// The sketch's DMA path: expandLines() bands pushed as 16-bit images
+static void compareBands(const char *what, int32_t x, int32_t y) {
+  panelClear(BORDER);
+  banner8.pushSprite(x, y);
+  std::vector<uint16_t> want = grab(0, 0, 320, 240);
+
+  panelClear(BORDER);
+  banner1.setBitmapColor(TFT_WHITE, TFT_BLACK);
+  static uint16_t band[BANNER_W * BANNER_BAND_H];
+  for (int32_t top = 0; top < BANNER_H; top += BANNER_BAND_H) {
+    if (!CHECK(banner1.expandLines(top, BANNER_BAND_H, band), "%s: expandLines(%d) failed", what, (int)top)) return;
+    tft.pushImage(x, y + top, BANNER_W, BANNER_BAND_H, band);
+  }
+  CHECK(grab(0, 0, 320, 240) == want, "%s at %d,%d: expandLines() bands and 8-bit sprite differ", what, (int)x, (int)y);
+}
+
+// A 1-bit bitmap at every clipping offset off the top left corner
+static void checkBitmap(bool flash) {
+  const int32_t w = 37, h = 11;
+  uint8_t data[((w + 7) >> 3) * h];
+  srand(2);
+  for (size_t i = 0; i < sizeof(data); i++) data[i] = rand();
+  tft.setBitmapColor(TFT_GREEN, TFT_MAROON);
+
+  for (int32_t y = -h + 1; y <= 1; y++)
+    for (int32_t x = -w + 1; x <= 1; x++) {
+      panelClear(BORDER);
+      if (flash) tft.pushImage(x, y, w, h, (const uint8_t *)data, false);
+      else tft.pushImage(x, y, w, h, data, false);
+      for (int32_t py = 0; py < h + 2; py++)
+        for (int32_t px = 0; px < w + 2; px++) {
+          int32_t ix = px - x, iy = py - y;
+          uint16_t want = (ix >= 0 && iy >= 0 && ix < w && iy < h) ? bitColor(data, w, ix, iy, TFT_GREEN, TFT_MAROON) : BORDER;
+          if (!CHECK(panelPixel(px, py) == want, "%s bitmap at %d,%d: pixel %d,%d is 0x%04X, expected 0x%04X",
+                     flash ? "FLASH" : "RAM", (int)x, (int)y, (int)px, (int)py, panelPixel(px, py), want)) return;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+  tft.init();
+  tft.setRotation(1);
+
+  banner1.setColorDepth(1);
+  banner8.setColorDepth(8);
+  if (!CHECK(banner1.createSprite(BANNER_W, BANNER_H) && banner8.createSprite(BANNER_W, BANNER_H), "sprites not created"))
+    return report("sprite_1bpp");
+  banner1.setTextDatum(TL_DATUM);
+  banner8.setTextDatum(TL_DATUM);
+  banner1.setFreeFont(&Orbitron_Medium10pt7b);
+  banner8.setFreeFont(&Orbitron_Medium10pt7b);
+
+  const int32_t scroll[] = { BANNER_W, 200, 0, -3, -150, -500 };
+  for (int32_t textX : scroll) {
+    char what[32];
+    snprintf(what, sizeof(what), "text at %d", (int)textX);
+    drawBanner(textX);
+
+    compareSprites(what, 5, 205);     // Where the sketch puts it
+    compareSprites(what, -3, 205);    // Off the left edge, dx = 3
+    compareSprites(what, -21, -7);    // Off the top left, dx = 21, dy = 7
+    compareSprites(what, 13, 225);    // Off the bottom right
+    tft.setViewport(40, 210, 101, 17, false);
+    compareSprites("viewport", 5, 205);
+    tft.resetViewport();
+
+    compareBands(what, 5, 205);
+    compareBands(what, -11, -3);
+  }
+
+  // expandLines() only works on whole lines of an unrotated 1-bit sprite
+  uint16_t band[BANNER_W * 2];
+  CHECK(!banner1.expandLines(-1, 2, band), "expandLines() accepted line -1");
+  CHECK(!banner1.expandLines(BANNER_H - 1, 2, band), "expandLines() accepted lines past the end");
+  CHECK(!banner1.expandLines(0, 0, band), "expandLines() accepted 0 lines");
+  CHECK(!banner8.expandLines(0, 1, band), "expandLines() accepted an 8-bit sprite");
+  banner1.setRotation(1);
+  CHECK(!banner1.expandLines(0, 1, band), "expandLines() accepted a rotated sprite");
+  banner1.setRotation(0);
+
+  // Odd widths, each line must start on its own byte
+  for (int32_t w = 1; w <= 20; w++) {
+    TFT_eSprite s(&tft);
+    s.setColorDepth(1);
+    s.createSprite(w, 3);
+    s.fillSprite(0);
+    for (int32_t i = 0; i < w * 3; i += 3) s.drawPixel(i % w, i / w, 1);
+    s.setBitmapColor(TFT_WHITE, TFT_BLACK);
+    uint16_t lines[20 * 3];
+    s.expandLines(0, 3, lines);
+    for (int32_t i = 0; i < w * 3; i++) {
+      uint16_t want = (i % 3 == 0) ? 0xFFFF : 0x0000;
+      if (!CHECK(lines[i] == want, "width %d: pixel %d is 0x%04X", (int)w, (int)i, lines[i])) break;
+    }
+    s.deleteSprite();
+  }
+
+  checkBitmap(true);
+  checkBitmap(false);
+
+  if (benchmarks(argc, argv)) {
+    drawBanner(0);
+    banner1.setBitmapColor(TFT_WHITE, TFT_BLACK);
+    static uint16_t banner16[BANNER_W * BANNER_H];
+    const uint8_t *bits = (const uint8_t *)banner1.getPointer();
+
+    // The old per-pixel loop, into the same buffer
+    double oldNs = nsPerCall([&]() {
+      uint8_t *linePtr = (uint8_t *)banner16;
+      for (int32_t y = 0; y < BANNER_H; y++)
+        for (int32_t x = 0; x < BANNER_W; x++) {
+          uint16_t col = bits[((BANNER_W + 7) >> 3) * y + (x >> 3)] & (0x80 >> (x & 0x7));
+          if (col) { *linePtr++ = TFT_WHITE >> 8; *linePtr++ = (uint8_t)TFT_WHITE; }
+          else     { *linePtr++ = TFT_BLACK >> 8; *linePtr++ = (uint8_t)TFT_BLACK; }
+        }
+    });
+    double newNs = nsPerCall([&]() { banner1.expandLines(0, BANNER_H, banner16); });
+    printf("%-16s %12s %12s\n", "310 x 30 banner", "per-pixel us", "bytes us");
+    printf("%-16s %12.2f %12.2f\n", "", oldNs / 1000, newNs / 1000);
+  }
+
+  CHECK(panelErrors() == 0, "%u panel bus errors", panelErrors());
+  return report("sprite_1bpp");
+}
@@ -0,0 +1,145 @@
+/*
+  getUnicodeIndex() with the index built by buildUnicodeIndex(), against the
+  linear scan of gUnicode[] it replaced.
+
+  Every code point 0x0000-0xFFFF is looked up in the example fonts, in a
+  made up font with unsorted and duplicated codes, and in the same fonts
+  when the index cannot be allocated (the linear scan fallback). The glyph
+  number found, or not found, must be the same as the linear scan.
+
+  "unicode_index --bench" also times the lookups and the index build.
+*/
+
+#include "host_test.h"
+
+// The old getUnicodeIndex(), first glyph with the code in file order
+static bool linearScan(TFT_eSPI &tft, uint16_t unicode, uint16_t *index) {
+  for (uint16_t i = 0; i < tft.gFont.gCount; i++) {
+    if (tft.gUnicode[i] == unicode) {
+      *index = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Fails the next malloc() of a given size, to take the fallback path of buildUnicodeIndex()
+extern "C" void *__libc_malloc(size_t size);
+static size_t failSize = 0;
+static int    failedAllocs = 0;
+
+extern "C" void *malloc(size_t size) {
+  if (failSize && size == failSize) {
+    failSize = 0;
+    failedAllocs++;
+    return NULL;
+  }
+  return __libc_malloc(size);
+}
+
+// Size of the index allocation for a font with gCount glyphs
+static size_t indexSize(uint16_t gCount) {
+  return (0x80 + gCount) * 2;
+}
+
+static void compareAll(const char *font, TFT_eSPI &tft) {
+  uint32_t found = 0;
+  for (uint32_t code = 0; code <= 0xFFFF; code++) {
+    uint16_t want = 0, got = 0;
+    bool wantFound = linearScan(tft, code, &want);
+    bool gotFound = tft.getUnicodeIndex(code, &got);
+    if (!CHECK(gotFound == wantFound && (!wantFound || got == want),
+               "%s: code 0x%04X gives %s %u, the linear scan %s %u", font, (unsigned)code,
+               gotFound ? "glyph" : "no glyph", got, wantFound ? "glyph" : "no glyph", want)) return;
+    found += wantFound;
+  }
+  CHECK(found > 0, "%s: no glyph found", font);
+}
+
+// Builds a VLW font in memory, glyphs of 1 x 1 pixel with the codes given
+static std::vector<uint8_t> makeFont(const std::vector<uint16_t> &codes) {
+  std::vector<uint8_t> vlw;
+  auto put = [&](uint32_t v) { for (int s = 24; s >= 0; s -= 8) vlw.push_back(v >> s); };
+  put(codes.size()); put(11); put(10); put(0); put(8); put(2);
+  for (uint16_t code : codes) { put(code); put(1); put(1); put(2); put(1); put(0); put(0); }
+  for (size_t i = 0; i < codes.size(); i++) vlw.push_back(0xFF);
+  return vlw;
+}
+
+struct FontFile {
+  const char *dir;
+  const char *name;
+};
+
+static const FontFile fontFiles[] = {
+  { FONT_DIR_DEMO,    "NotoSansBold15" },
+  { FONT_DIR_DEMO,    "NotoSansBold36" },
+  { FONT_DIR_DEMO,    "NotoSansMonoSCB20" },
+  { FONT_DIR_UNICODE, "Final-Frontier-28" },
+  { FONT_DIR_UNICODE, "Latin-Hiragana-24" },
+  { FONT_DIR_UNICODE, "Unicode-Test-72" },
+};
+
+static TFT_eSPI tft;
+
+int main(int argc, char **argv) {
+  std::vector<std::vector<uint8_t> > arrays;
+
+  // Example font files, indexed and with the index allocation failing
+  for (const FontFile &f : fontFiles) {
+    fs::FS dir(f.dir);
+    tft.loadFont(f.name, dir);
+    if (!CHECK(tft.fontLoaded, "%s: not loaded", f.name)) continue;
+    compareAll(f.name, tft);
+
+    arrays.push_back(readFile(std::string(f.dir) + "/" + f.name + ".vlw"));
+    failSize = indexSize(tft.gFont.gCount);
+    failedAllocs = 0;
+    tft.loadFont(arrays.back().data());
+    CHECK(failedAllocs == 1, "%s: index allocation not attempted", f.name);
+    compareAll(f.name, tft);
+    failSize = 0;
+  }
+
+  // Codes out of order, duplicated in and above ASCII, at the ends of the ranges
+  std::vector<uint16_t> codes = { 0x0041, 0x3042, 0x0020, 0x00E9, 0x0041, 0xFFFF, 0x007F, 0x0080,
+                                  0x3042, 0x0000, 0x00E9, 0x0100, 0x00FF, 0x3041, 0x007E, 0x0081 };
+  std::vector<uint8_t> unsorted = makeFont(codes);
+  tft.loadFont(unsorted.data());
+  compareAll("unsorted", tft);
+  failSize = indexSize(codes.size());
+  failedAllocs = 0;
+  tft.loadFont(unsorted.data());
+  CHECK(failedAllocs == 1, "unsorted: index allocation not attempted");
+  compareAll("unsorted", tft);
+  failSize = 0;
+
+  tft.unloadFont();
+
+  if (benchmarks(argc, argv)) {
+    printf("%-18s %6s %10s %10s %14s %14s\n", "font", "glyphs", "scan ns", "index ns", "load us", "no index us");
+    for (size_t i = 0; i < arrays.size(); i++) {
+      const uint8_t *array = arrays[i].data();
+
+      // Look up each code of the font in turn, as drawing text in that font does
+      tft.loadFont(array);
+      std::vector<uint16_t> fontCodes(tft.gUnicode, tft.gUnicode + tft.gFont.gCount);
+      size_t n = 0;
+      volatile uint16_t sink;
+      double indexNs = nsPerCall([&]() { uint16_t g = 0; tft.getUnicodeIndex(fontCodes[n++ % fontCodes.size()], &g); sink = g; });
+      double scanNs = nsPerCall([&]() { uint16_t g = 0; linearScan(tft, fontCodes[n++ % fontCodes.size()], &g); sink = g; });
+      (void)sink;
+
+      // loadFont() from an array with and without building the index
+      double loadNs = nsPerCall([&]() { tft.loadFont(array); });
+      uint16_t gCount = tft.gFont.gCount;
+      double noIndexNs = nsPerCall([&]() { failSize = indexSize(gCount); tft.loadFont(array); });
+      failSize = 0;
+
+      printf("%-18s %6u %10.1f %10.1f %14.2f %14.2f\n", fontFiles[i].name, gCount, scanNs, indexNs, loadNs / 1000, noIndexNs / 1000);
+    }
+    tft.unloadFont();
+  }
+
+  return report("unicode_index");
+}
@@ -0,0 +1,207 @@
+/*
+  The address window cache of setWindow() and drawPixel() (TFT_WINDOW_CACHE).
+
+  The Makefile builds this test twice, as window_cache with the cache and
+  as window_cache_off with TFT_NO_WINDOW_CACHE, and both must pass:
+
+  - the address commands and SPI bytes sent for fillRect() runs, drawPixel()
+    runs and a glyph must be the counts expected for the build
+  - fillRect(), drawPixel() and text, mixed with readRect() and readPixel()
+    (which set their own read window), setRotation() and init(), must leave
+    the panel as a sprite drawn with the same calls. After each read and
+    each rotation the window used just before is drawn again, so a cache
+    that was not reset would skip a needed address command.
+
+  "window_cache --bench" also prints the counts.
+*/
+
+#include "host_test.h"
+
+#ifdef TFT_NO_WINDOW_CACHE
+  #define BUILD_NAME "window_cache_off"
+#else
+  #define BUILD_NAME "window_cache"
+#endif
+
+static TFT_eSPI    tft;
+static TFT_eSprite ref(&tft);
+
+static bool bench = false;
+
+// Counts for a drawing call, checked against the expected address commands
+static void counts(const char *what, uint32_t caset, uint32_t paset) {
+  CHECK(panelCounts.caset == caset && panelCounts.paset == paset, "%s: %u CASET and %u PASET, expected %u and %u",
+        what, panelCounts.caset, panelCounts.paset, caset, paset);
+  if (bench) printf("%-34s %6u %6u %6u %8u\n", what, panelCounts.caset, panelCounts.paset, panelCounts.ramwr, panelCounts.bytes);
+}
+
+static void countCommands(void) {
+#ifdef TFT_NO_WINDOW_CACHE
+  const bool cache = false;
+#else
+  const bool cache = true;
+#endif
+  if (bench) printf("%-34s %6s %6s %6s %8s\n", BUILD_NAME, "CASET", "PASET", "RAMWR", "bytes");
+
+  // Line spans of a changed area, same columns on each line
+  tft.fillRect(0, 0, 1, 1, TFT_BLACK); // Some other window first
+  panelResetCounts();
+  for (int32_t y = 0; y < 54; y++) tft.fillRect(100, 60 + y, 40, 1, TFT_RED);
+  counts("54 fillRect() with the same columns", cache ? 1 : 54, 54);
+
+  // Runs along one line, same rows
+  panelResetCounts();
+  for (int32_t x = 0; x < 20; x++) tft.fillRect(10 + 3 * x, 20, 2, 1, TFT_GREEN);
+  counts("20 fillRect() on the same line", 20, cache ? 1 : 20);
+
+  // The same window again
+  panelResetCounts();
+  for (int32_t i = 0; i < 10; i++) tft.fillRect(50, 50, 8, 8, i);
+  counts("10 fillRect() of the same window", cache ? 1 : 10, cache ? 1 : 10);
+
+  // drawPixel() only sends a coordinate that changed, with or without the cache
+  tft.fillRect(0, 0, 1, 1, TFT_BLACK);
+  panelResetCounts();
+  for (int32_t x = 0; x < 20; x++) tft.drawPixel(30 + x, 100, TFT_WHITE);
+  counts("20 drawPixel() on the same line", 20, 1);
+
+  // A pixel after a fillRect() of the same point is only a memory write with the cache
+  tft.fillRect(70, 70, 1, 1, TFT_BLUE);
+  panelResetCounts();
+  tft.drawPixel(70, 70, TFT_WHITE);
+  counts("drawPixel() on a 1 x 1 fillRect()", cache ? 0 : 1, cache ? 0 : 1);
+
+  // A transparent anti-aliased glyph, runs and pixels on its lines
+  fs::FS fonts(FONT_DIR_DEMO);
+  tft.loadFont("NotoSansBold36", fonts);
+  tft.setTextColor(TFT_WHITE);
+  tft.fillRect(0, 0, 1, 1, TFT_BLACK);
+  panelResetCounts();
+  tft.drawString("8", 150, 100);
+  uint32_t glyphCaset = panelCounts.caset, glyphPaset = panelCounts.paset;
+  if (bench) counts("NotoSansBold36 '8', transparent", glyphCaset, glyphPaset);
+  // Runs and pixels move along each line, so the rows are sent once per line with the cache
+  uint16_t g = 0;
+  tft.getUnicodeIndex('8', &g);
+  CHECK(!cache || glyphPaset == tft.gHeight[g], "glyph: %u PASET for %u lines with the cache", glyphPaset, tft.gHeight[g]);
+  CHECK(cache || glyphCaset == panelCounts.ramwr, "glyph: %u CASET for %u writes without the cache", glyphCaset, panelCounts.ramwr);
+  tft.unloadFont();
+
+  // Font 2 text, opaque
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  panelResetCounts();
+  tft.drawString("12:34", 10, 200, 2);
+  if (bench) counts("Font 2 \"12:34\", opaque", panelCounts.caset, panelCounts.paset);
+}
+
+// Both the panel and the reference sprite
+template <typename F>
+static void both(F f) {
+  f(tft);
+  f(ref);
+}
+
+static void newReference(void) {
+  ref.deleteSprite();
+  ref.setColorDepth(16);
+  ref.createSprite(tft.width(), tft.height());
+  ref.fillSprite(TFT_BLACK);
+  tft.fillScreen(TFT_BLACK);
+}
+
+static bool sameAsReference(const char *what) {
+  for (int32_t y = 0; y < tft.height(); y++)
+    for (int32_t x = 0; x < tft.width(); x++)
+      if (panelPixel(x, y) != ref.readPixel(x, y))
+        return CHECK(false, "%s, rotation %u: pixel %d,%d is 0x%04X, expected 0x%04X", what, tft.getRotation(),
+                     (int)x, (int)y, panelPixel(x, y), ref.readPixel(x, y));
+  return true;
+}
+
+static uint16_t swap(uint16_t c) { return (c << 8) | (c >> 8); }
+
+static int32_t rnd(int32_t n) { return rand() % n; }
+
+// Random drawing with reads in between, each read followed by the window drawn before it
+static void mixed(const char *what, int steps) {
+  int32_t lx = 0, ly = 0, lw = 1, lh = 1;
+  for (int i = 0; i < steps; i++) {
+    int32_t x = rnd(tft.width() - 20), y = rnd(tft.height() - 20), w = 1 + rnd(20), h = 1 + rnd(20);
+    uint16_t c = rand();
+    switch (rnd(5)) {
+      case 0:
+        both([&](TFT_eSPI &d) { d.fillRect(x, y, w, h, c); });
+        lx = x; ly = y; lw = w; lh = h;
+        break;
+      case 1:
+        both([&](TFT_eSPI &d) { d.drawPixel(x, y, c); });
+        lx = x; ly = y; lw = 1; lh = 1;
+        break;
+      case 2:
+        both([&](TFT_eSPI &d) { d.setTextColor(c, ~c); d.drawString("Az9", x, y, 2); });
+        break;
+      case 3: {
+        uint16_t buf[400];
+        tft.readRect(x, y, w, h, buf);
+        for (int32_t j = 0; j < w * h; j++)
+          // readRect() returns the bytes swapped, ready for pushRect()
+          if (!CHECK(buf[j] == swap(ref.readPixel(x + j % w, y + j / w)), "%s: readRect() pixel %d,%d", what,
+                     (int)(x + j % w), (int)(y + j / w))) return;
+        c = rand();
+        both([&](TFT_eSPI &d) { d.fillRect(lx, ly, lw, lh, c); });
+        break;
+      }
+      default:
+        CHECK(tft.readPixel(x, y) == ref.readPixel(x, y), "%s: readPixel() %d,%d", what, (int)x, (int)y);
+        c = rand();
+        if (lw == 1 && lh == 1) both([&](TFT_eSPI &d) { d.drawPixel(lx, ly, c); });
+        else both([&](TFT_eSPI &d) { d.fillRect(lx, ly, lw, lh, c); });
+        break;
+    }
+  }
+  sameAsReference(what);
+}
+
+int main(int argc, char **argv) {
+  bench = benchmarks(argc, argv);
+
+  tft.init();
+  tft.setRotation(1);
+
+  countCommands();
+
+  // The directed cases: a window, a read elsewhere, the same window again
+  newReference();
+  both([](TFT_eSPI &d) { d.fillRect(40, 40, 30, 20, TFT_RED); });
+  uint16_t buf[16];
+  tft.readRect(200, 100, 4, 4, buf);
+  both([](TFT_eSPI &d) { d.fillRect(40, 40, 30, 20, TFT_GREEN); });
+  sameAsReference("fillRect(), readRect(), fillRect()");
+
+  both([](TFT_eSPI &d) { d.drawPixel(10, 10, TFT_RED); });
+  tft.readPixel(11, 10);
+  both([](TFT_eSPI &d) { d.drawPixel(10, 10, TFT_GREEN); });
+  sameAsReference("drawPixel(), readPixel(), drawPixel()");
+
+  // Each rotation, starting with the window drawn last in the previous one
+  srand(3);
+  for (int r = 0; r < 8; r++) {
+    tft.fillRect(5, 5, 10, 10, TFT_BLUE);
+    tft.setRotation(r & 3);
+    newReference();
+    both([](TFT_eSPI &d) { d.fillRect(5, 5, 10, 10, TFT_YELLOW); });
+    sameAsReference("after setRotation()");
+    mixed("mixed drawing and reads", 300);
+  }
+
+  // init() resets the panel's address registers
+  tft.fillRect(5, 5, 10, 10, TFT_BLUE);
+  tft.init();
+  tft.setRotation(0);
+  newReference();
+  both([](TFT_eSPI &d) { d.fillRect(5, 5, 10, 10, TFT_YELLOW); });
+  sameAsReference("after init()");
+
+  CHECK(panelErrors() == 0, "%u panel bus errors", panelErrors());
+  return report(BUILD_NAME);
+}
@@ -0,0 +1,124 @@
+// Generated by TFT_eSPI Tools/gfxff2rle from HB9IIU7seg42ptItalic.h
+// Run-length encoded free font, select it with setFreeFontRLE(&digital_7_monoitalic42pt7bRLE)
+
+const uint8_t digital_7_monoitalic42pt7bRLEBitmaps[] PROGMEM = {
+  0x02, 0x08, 0x18, 0x01, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03, 0x02, 0x06,
+  0x18, 0x02, 0x04, 0x02, 0x05, 0x19, 0x01, 0x05, 0x02, 0x07, 0x16, 0x02,
+  0x05, 0x03, 0x05, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x05, 0x03, 0x16,
+  0x06, 0x12, 0x05, 0x06, 0x13, 0x06, 0x22, 0x04, 0x06, 0x14, 0x06, 0x52,
+  0x04, 0x06, 0x13, 0x06, 0x32, 0x03, 0x06, 0x14, 0x06, 0x02, 0x03, 0x05,
+  0x15, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x02, 0x03, 0x03, 0x19, 0x03,
+  0x02, 0x04, 0x01, 0x1B, 0x01, 0x10, 0x02, 0x03, 0x02, 0x1B, 0x01, 0x02,
+  0x02, 0x03, 0x1A, 0x03, 0x02, 0x02, 0x04, 0x17, 0x05, 0x02, 0x02, 0x05,
+  0x15, 0x05, 0x42, 0x02, 0x06, 0x13, 0x06, 0x02, 0x02, 0x05, 0x14, 0x06,
+  0x22, 0x01, 0x06, 0x14, 0x06, 0x52, 0x01, 0x06, 0x13, 0x06, 0x02, 0x00,
+  0x04, 0x16, 0x06, 0x03, 0x00, 0x01, 0x04, 0x13, 0x02, 0x06, 0x02, 0x02,
+  0x17, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18, 0x02,
+  0x04, 0x02, 0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x01,
+  0x07, 0x01, 0x01, 0x06, 0x03, 0x01, 0x06, 0x04, 0x11, 0x05, 0x05, 0x61,
+  0x04, 0x06, 0x91, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x04, 0x04, 0x01,
+  0x05, 0x03, 0x01, 0x06, 0x01, 0x10, 0x01, 0x06, 0x01, 0x01, 0x05, 0x03,
+  0x01, 0x03, 0x05, 0x01, 0x02, 0x05, 0x81, 0x01, 0x06, 0x81, 0x00, 0x06,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x02, 0x08, 0x18, 0x01, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03, 0x02, 0x06,
+  0x18, 0x02, 0x04, 0x02, 0x05, 0x19, 0x01, 0x05, 0x02, 0x07, 0x16, 0x02,
+  0x05, 0x02, 0x0A, 0x13, 0x01, 0x06, 0x51, 0x1E, 0x06, 0x91, 0x1D, 0x06,
+  0x01, 0x1D, 0x05, 0x01, 0x1E, 0x04, 0x02, 0x08, 0x15, 0x02, 0x03, 0x02,
+  0x07, 0x17, 0x02, 0x01, 0x01, 0x06, 0x18, 0x01, 0x06, 0x19, 0x02, 0x03,
+  0x02, 0x02, 0x16, 0x02, 0x02, 0x03, 0x03, 0x14, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x05, 0x41, 0x02, 0x06, 0x01, 0x02, 0x05, 0x81, 0x01, 0x06, 0x01,
+  0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x16, 0x01, 0x02, 0x19, 0x01, 0x00,
+  0x1B, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x1B, 0x01, 0x02, 0x1A, 0x02, 0x08,
+  0x18, 0x01, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03, 0x02, 0x06, 0x18, 0x02,
+  0x04, 0x02, 0x05, 0x19, 0x01, 0x05, 0x02, 0x07, 0x16, 0x02, 0x05, 0x02,
+  0x0A, 0x13, 0x01, 0x06, 0x51, 0x1E, 0x06, 0x91, 0x1D, 0x06, 0x01, 0x1D,
+  0x05, 0x01, 0x1E, 0x04, 0x02, 0x08, 0x15, 0x02, 0x03, 0x02, 0x07, 0x17,
+  0x02, 0x01, 0x01, 0x06, 0x18, 0x01, 0x06, 0x19, 0x02, 0x07, 0x16, 0x03,
+  0x01, 0x02, 0x08, 0x14, 0x03, 0x03, 0x01, 0x1D, 0x05, 0x01, 0x1C, 0x05,
+  0x81, 0x1B, 0x06, 0x61, 0x1A, 0x06, 0x02, 0x05, 0x13, 0x02, 0x06, 0x02,
+  0x02, 0x17, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18,
+  0x02, 0x04, 0x02, 0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02,
+  0x01, 0x1E, 0x01, 0x01, 0x1D, 0x03, 0x01, 0x1D, 0x04, 0x02, 0x02, 0x01,
+  0x19, 0x05, 0x02, 0x02, 0x04, 0x16, 0x05, 0x32, 0x02, 0x06, 0x13, 0x06,
+  0x22, 0x01, 0x06, 0x14, 0x06, 0x52, 0x01, 0x06, 0x13, 0x06, 0x32, 0x00,
+  0x06, 0x14, 0x06, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x04, 0x17,
+  0x04, 0x03, 0x00, 0x03, 0x02, 0x15, 0x02, 0x03, 0x03, 0x01, 0x01, 0x02,
+  0x17, 0x02, 0x01, 0x01, 0x03, 0x18, 0x01, 0x03, 0x19, 0x02, 0x04, 0x16,
+  0x03, 0x01, 0x02, 0x05, 0x14, 0x03, 0x03, 0x01, 0x1A, 0x05, 0x01, 0x19,
+  0x05, 0x81, 0x18, 0x06, 0x81, 0x17, 0x06, 0x01, 0x17, 0x05, 0x01, 0x18,
+  0x04, 0x01, 0x18, 0x03, 0x01, 0x18, 0x02, 0x01, 0x08, 0x1A, 0x11, 0x06,
+  0x1B, 0x01, 0x05, 0x1B, 0x01, 0x07, 0x19, 0x02, 0x05, 0x01, 0x04, 0x15,
+  0x01, 0x05, 0x03, 0x11, 0x05, 0x06, 0x81, 0x04, 0x06, 0x31, 0x03, 0x06,
+  0x01, 0x03, 0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x03, 0x02, 0x15, 0x02,
+  0x04, 0x01, 0x02, 0x17, 0x01, 0x06, 0x18, 0x01, 0x06, 0x19, 0x02, 0x07,
+  0x16, 0x03, 0x01, 0x02, 0x08, 0x14, 0x03, 0x03, 0x01, 0x1D, 0x05, 0x01,
+  0x1C, 0x05, 0x81, 0x1B, 0x06, 0x61, 0x1A, 0x06, 0x02, 0x05, 0x13, 0x02,
+  0x06, 0x02, 0x02, 0x17, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02,
+  0x01, 0x18, 0x02, 0x04, 0x02, 0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18,
+  0x01, 0x02, 0x01, 0x08, 0x1A, 0x11, 0x06, 0x1B, 0x01, 0x05, 0x1B, 0x01,
+  0x07, 0x19, 0x02, 0x05, 0x01, 0x04, 0x15, 0x01, 0x05, 0x03, 0x11, 0x05,
+  0x06, 0x81, 0x04, 0x06, 0x31, 0x03, 0x06, 0x01, 0x03, 0x05, 0x01, 0x03,
+  0x04, 0x02, 0x03, 0x03, 0x02, 0x15, 0x02, 0x04, 0x01, 0x02, 0x17, 0x01,
+  0x06, 0x18, 0x01, 0x06, 0x19, 0x03, 0x03, 0x02, 0x02, 0x16, 0x03, 0x01,
+  0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x03, 0x02, 0x02, 0x04, 0x17, 0x05,
+  0x02, 0x02, 0x05, 0x15, 0x05, 0x42, 0x02, 0x06, 0x13, 0x06, 0x02, 0x02,
+  0x05, 0x14, 0x06, 0x22, 0x01, 0x06, 0x14, 0x06, 0x52, 0x01, 0x06, 0x13,
+  0x06, 0x02, 0x00, 0x04, 0x16, 0x06, 0x03, 0x00, 0x01, 0x04, 0x13, 0x02,
+  0x06, 0x02, 0x02, 0x17, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02,
+  0x01, 0x18, 0x02, 0x04, 0x02, 0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18,
+  0x01, 0x02, 0x02, 0x05, 0x18, 0x01, 0x01, 0x02, 0x03, 0x19, 0x01, 0x03,
+  0x02, 0x03, 0x18, 0x02, 0x04, 0x02, 0x02, 0x19, 0x01, 0x05, 0x02, 0x04,
+  0x16, 0x02, 0x05, 0x03, 0x02, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x02,
+  0x03, 0x16, 0x06, 0x12, 0x02, 0x06, 0x13, 0x06, 0x22, 0x01, 0x06, 0x14,
+  0x06, 0x52, 0x01, 0x06, 0x13, 0x06, 0x32, 0x00, 0x06, 0x14, 0x06, 0x02,
+  0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x03,
+  0x19, 0x03, 0x02, 0x01, 0x01, 0x1B, 0x01, 0x10, 0x01, 0x1D, 0x01, 0x01,
+  0x1C, 0x03, 0x01, 0x1A, 0x05, 0x01, 0x19, 0x05, 0x81, 0x18, 0x06, 0x81,
+  0x17, 0x06, 0x01, 0x17, 0x05, 0x01, 0x18, 0x04, 0x01, 0x18, 0x03, 0x01,
+  0x18, 0x02, 0x02, 0x08, 0x18, 0x01, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03,
+  0x02, 0x06, 0x18, 0x02, 0x04, 0x02, 0x05, 0x19, 0x01, 0x05, 0x02, 0x07,
+  0x16, 0x02, 0x05, 0x03, 0x05, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x05,
+  0x03, 0x16, 0x06, 0x12, 0x05, 0x06, 0x13, 0x06, 0x22, 0x04, 0x06, 0x14,
+  0x06, 0x52, 0x04, 0x06, 0x13, 0x06, 0x32, 0x03, 0x06, 0x14, 0x06, 0x02,
+  0x03, 0x05, 0x15, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x03, 0x03, 0x03,
+  0x02, 0x15, 0x02, 0x03, 0x03, 0x04, 0x01, 0x02, 0x17, 0x02, 0x01, 0x01,
+  0x06, 0x18, 0x01, 0x06, 0x19, 0x03, 0x03, 0x02, 0x02, 0x16, 0x03, 0x01,
+  0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x03, 0x02, 0x02, 0x04, 0x17, 0x05,
+  0x02, 0x02, 0x05, 0x15, 0x05, 0x42, 0x02, 0x06, 0x13, 0x06, 0x02, 0x02,
+  0x05, 0x14, 0x06, 0x22, 0x01, 0x06, 0x14, 0x06, 0x52, 0x01, 0x06, 0x13,
+  0x06, 0x02, 0x00, 0x04, 0x16, 0x06, 0x03, 0x00, 0x01, 0x04, 0x13, 0x02,
+  0x06, 0x02, 0x02, 0x17, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02,
+  0x01, 0x18, 0x02, 0x04, 0x02, 0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18,
+  0x01, 0x02, 0x02, 0x08, 0x18, 0x01, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03,
+  0x02, 0x06, 0x18, 0x02, 0x04, 0x02, 0x05, 0x19, 0x01, 0x05, 0x02, 0x07,
+  0x16, 0x02, 0x05, 0x03, 0x05, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x05,
+  0x03, 0x16, 0x06, 0x12, 0x05, 0x06, 0x13, 0x06, 0x22, 0x04, 0x06, 0x14,
+  0x06, 0x52, 0x04, 0x06, 0x13, 0x06, 0x32, 0x03, 0x06, 0x14, 0x06, 0x02,
+  0x03, 0x05, 0x15, 0x05, 0x02, 0x03, 0x04, 0x17, 0x04, 0x03, 0x03, 0x03,
+  0x02, 0x15, 0x02, 0x03, 0x03, 0x04, 0x01, 0x02, 0x17, 0x02, 0x01, 0x01,
+  0x06, 0x18, 0x01, 0x06, 0x19, 0x02, 0x07, 0x16, 0x03, 0x01, 0x02, 0x08,
+  0x14, 0x03, 0x03, 0x01, 0x1D, 0x05, 0x01, 0x1C, 0x05, 0x81, 0x1B, 0x06,
+  0x61, 0x1A, 0x06, 0x02, 0x05, 0x13, 0x02, 0x06, 0x02, 0x02, 0x17, 0x01,
+  0x06, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18, 0x02, 0x04, 0x02,
+  0x01, 0x19, 0x01, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x21, 0x03, 0x06,
+  0x21, 0x02, 0x06, 0xF0, 0x10, 0x51, 0x00, 0x06 };
+
+const GFXglyph digital_7_monoitalic42pt7bRLEGlyphs[] PROGMEM = {
+  {     0,  36,  54,  39,    1,  -53 },   // 0x30 '0'
+  {   155,  10,  54,  39,   27,  -53 },   // 0x31 '1'
+  {   216,  36,  54,  39,    1,  -53 },   // 0x32 '2'
+  {   322,  36,  54,  39,    1,  -53 },   // 0x33 '3'
+  {   432,  33,  54,  39,    4,  -53 },   // 0x34 '4'
+  {   535,  34,  54,  39,    1,  -53 },   // 0x35 '5'
+  {   638,  34,  54,  39,    1,  -53 },   // 0x36 '6'
+  {   770,  33,  54,  39,    4,  -53 },   // 0x37 '7'
+  {   878,  36,  54,  39,    1,  -53 },   // 0x38 '8'
+  {  1046,  36,  54,  39,    1,  -53 },   // 0x39 '9'
+  {  1185,   9,  30,  39,   15,  -41 } }; // 0x3A ':'
+
+const GFXrlefont digital_7_monoitalic42pt7bRLE PROGMEM = {
+  (uint8_t  *)digital_7_monoitalic42pt7bRLEBitmaps,
+  (GFXglyph *)digital_7_monoitalic42pt7bRLEGlyphs,
+  0x30, 0x3A, 45 };
+
+// Approx. 1280 bytes
@@ -0,0 +1,110 @@
+// Generated by TFT_eSPI Tools/gfxff2rle from HB9IIU7seg42ptNormal.h
+// Run-length encoded free font, select it with setFreeFontRLE(&digital_7__mono_42pt7bRLE)
+
+const uint8_t digital_7__mono_42pt7bRLEBitmaps[] PROGMEM = {
+  0x02, 0x02, 0x18, 0x01, 0x02, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x00,
+  0x19, 0x01, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x02, 0x16, 0x02,
+  0x05, 0x03, 0x00, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x00, 0x03, 0x16,
+  0x06, 0xE2, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02,
+  0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x03, 0x19, 0x03, 0x02, 0x01, 0x01,
+  0x1B, 0x01, 0x10, 0x02, 0x01, 0x01, 0x1B, 0x01, 0x02, 0x00, 0x03, 0x19,
+  0x03, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x05, 0x15, 0x05, 0xE2,
+  0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x03, 0x16, 0x06, 0x03, 0x00, 0x01,
+  0x04, 0x13, 0x01, 0x06, 0x02, 0x02, 0x16, 0x02, 0x05, 0x02, 0x00, 0x18,
+  0x02, 0x05, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18, 0x02, 0x03,
+  0x02, 0x02, 0x18, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x21,
+  0x01, 0x05, 0xF1, 0x00, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01,
+  0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0xF1, 0x00, 0x06,
+  0x01, 0x00, 0x06, 0x21, 0x01, 0x05, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02,
+  0x02, 0x02, 0x18, 0x01, 0x02, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x00,
+  0x19, 0x01, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x02, 0x16, 0x02,
+  0x05, 0x02, 0x05, 0x13, 0x01, 0x06, 0xF1, 0x19, 0x06, 0x01, 0x1A, 0x05,
+  0x01, 0x1B, 0x04, 0x02, 0x05, 0x15, 0x02, 0x03, 0x02, 0x04, 0x17, 0x02,
+  0x01, 0x01, 0x04, 0x18, 0x01, 0x03, 0x19, 0x02, 0x01, 0x01, 0x02, 0x17,
+  0x02, 0x00, 0x03, 0x02, 0x15, 0x01, 0x00, 0x04, 0x01, 0x00, 0x05, 0xE1,
+  0x00, 0x06, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x04, 0x15, 0x01, 0x02,
+  0x18, 0x11, 0x00, 0x1B, 0x01, 0x01, 0x1A, 0x01, 0x02, 0x1A, 0x02, 0x02,
+  0x18, 0x01, 0x02, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x00, 0x19, 0x01,
+  0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x02, 0x16, 0x02, 0x05, 0x02,
+  0x04, 0x14, 0x01, 0x06, 0xF1, 0x19, 0x06, 0x01, 0x1A, 0x05, 0x01, 0x1B,
+  0x04, 0x02, 0x05, 0x15, 0x02, 0x03, 0x02, 0x04, 0x17, 0x02, 0x01, 0x11,
+  0x03, 0x19, 0x02, 0x04, 0x17, 0x02, 0x01, 0x02, 0x05, 0x15, 0x02, 0x03,
+  0x01, 0x1B, 0x04, 0x01, 0x1A, 0x05, 0xF1, 0x19, 0x06, 0x02, 0x04, 0x14,
+  0x01, 0x06, 0x02, 0x02, 0x16, 0x02, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05,
+  0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x02,
+  0x18, 0x01, 0x02, 0x01, 0x1B, 0x02, 0x01, 0x1B, 0x03, 0x01, 0x1A, 0x05,
+  0x02, 0x00, 0x01, 0x19, 0x05, 0x02, 0x00, 0x04, 0x16, 0x05, 0xF2, 0x00,
+  0x06, 0x13, 0x06, 0x02, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x05, 0x15,
+  0x05, 0x02, 0x00, 0x04, 0x17, 0x04, 0x03, 0x00, 0x03, 0x02, 0x15, 0x02,
+  0x03, 0x03, 0x01, 0x01, 0x02, 0x17, 0x02, 0x01, 0x01, 0x04, 0x18, 0x01,
+  0x03, 0x19, 0x02, 0x04, 0x17, 0x02, 0x01, 0x02, 0x05, 0x15, 0x02, 0x03,
+  0x01, 0x1B, 0x04, 0x01, 0x1A, 0x05, 0xF1, 0x19, 0x06, 0x01, 0x19, 0x06,
+  0x21, 0x1A, 0x05, 0x01, 0x1B, 0x03, 0x01, 0x1B, 0x02, 0x01, 0x02, 0x1A,
+  0x01, 0x01, 0x1A, 0x11, 0x00, 0x1B, 0x01, 0x02, 0x18, 0x02, 0x00, 0x01,
+  0x04, 0x15, 0x01, 0x00, 0x03, 0xE1, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01,
+  0x00, 0x04, 0x02, 0x00, 0x03, 0x02, 0x15, 0x02, 0x01, 0x01, 0x02, 0x17,
+  0x01, 0x04, 0x18, 0x01, 0x03, 0x19, 0x02, 0x04, 0x17, 0x02, 0x01, 0x02,
+  0x05, 0x15, 0x02, 0x03, 0x01, 0x1B, 0x04, 0x01, 0x1A, 0x05, 0xF1, 0x19,
+  0x06, 0x02, 0x05, 0x13, 0x01, 0x06, 0x02, 0x02, 0x16, 0x02, 0x05, 0x02,
+  0x00, 0x18, 0x02, 0x05, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x01, 0x18,
+  0x02, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x01, 0x02, 0x1A, 0x01, 0x01,
+  0x1A, 0x11, 0x00, 0x1B, 0x01, 0x02, 0x18, 0x02, 0x00, 0x01, 0x04, 0x15,
+  0x01, 0x00, 0x03, 0xE1, 0x00, 0x06, 0x01, 0x00, 0x05, 0x01, 0x00, 0x04,
+  0x02, 0x00, 0x03, 0x02, 0x15, 0x02, 0x01, 0x01, 0x02, 0x17, 0x01, 0x04,
+  0x18, 0x01, 0x03, 0x19, 0x03, 0x01, 0x01, 0x02, 0x17, 0x02, 0x01, 0x03,
+  0x00, 0x03, 0x02, 0x15, 0x02, 0x03, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02,
+  0x00, 0x05, 0x15, 0x05, 0xE2, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x03,
+  0x16, 0x06, 0x03, 0x00, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x02, 0x16,
+  0x02, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x00, 0x19, 0x01, 0x05,
+  0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x02, 0x02,
+  0x18, 0x01, 0x02, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x00, 0x19, 0x01,
+  0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x02, 0x16, 0x02, 0x05, 0x03,
+  0x00, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x00, 0x03, 0x16, 0x06, 0xE2,
+  0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x04,
+  0x17, 0x04, 0x02, 0x00, 0x03, 0x19, 0x03, 0x02, 0x01, 0x01, 0x1B, 0x01,
+  0x10, 0x01, 0x1D, 0x01, 0x01, 0x1C, 0x03, 0x01, 0x1B, 0x04, 0x01, 0x1A,
+  0x05, 0xF1, 0x19, 0x06, 0x01, 0x19, 0x06, 0x21, 0x1A, 0x05, 0x01, 0x1B,
+  0x03, 0x01, 0x1B, 0x02, 0x02, 0x02, 0x18, 0x01, 0x02, 0x02, 0x01, 0x18,
+  0x02, 0x03, 0x02, 0x00, 0x19, 0x01, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05,
+  0x02, 0x02, 0x16, 0x02, 0x05, 0x03, 0x00, 0x01, 0x04, 0x13, 0x01, 0x06,
+  0x02, 0x00, 0x03, 0x16, 0x06, 0xE2, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00,
+  0x05, 0x15, 0x05, 0x02, 0x00, 0x04, 0x17, 0x04, 0x03, 0x00, 0x03, 0x02,
+  0x15, 0x02, 0x03, 0x03, 0x01, 0x01, 0x02, 0x17, 0x02, 0x01, 0x01, 0x04,
+  0x18, 0x01, 0x03, 0x19, 0x03, 0x01, 0x01, 0x02, 0x17, 0x02, 0x01, 0x03,
+  0x00, 0x03, 0x02, 0x15, 0x02, 0x03, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02,
+  0x00, 0x05, 0x15, 0x05, 0xE2, 0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x03,
+  0x16, 0x06, 0x03, 0x00, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x02, 0x16,
+  0x02, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x00, 0x19, 0x01, 0x05,
+  0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x02, 0x02,
+  0x18, 0x01, 0x02, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x00, 0x19, 0x01,
+  0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x02, 0x16, 0x02, 0x05, 0x03,
+  0x00, 0x01, 0x04, 0x13, 0x01, 0x06, 0x02, 0x00, 0x03, 0x16, 0x06, 0xE2,
+  0x00, 0x06, 0x13, 0x06, 0x02, 0x00, 0x05, 0x15, 0x05, 0x02, 0x00, 0x04,
+  0x17, 0x04, 0x03, 0x00, 0x03, 0x02, 0x15, 0x02, 0x03, 0x03, 0x01, 0x01,
+  0x02, 0x17, 0x02, 0x01, 0x01, 0x04, 0x18, 0x01, 0x03, 0x19, 0x02, 0x04,
+  0x17, 0x02, 0x01, 0x02, 0x05, 0x15, 0x02, 0x03, 0x01, 0x1B, 0x04, 0x01,
+  0x1A, 0x05, 0xF1, 0x19, 0x06, 0x02, 0x05, 0x13, 0x01, 0x06, 0x02, 0x02,
+  0x16, 0x02, 0x05, 0x02, 0x00, 0x18, 0x02, 0x05, 0x02, 0x00, 0x19, 0x01,
+  0x05, 0x02, 0x01, 0x18, 0x02, 0x03, 0x02, 0x02, 0x18, 0x01, 0x02, 0x51,
+  0x00, 0x06, 0xF0, 0x10, 0x51, 0x00, 0x06 };
+
+const GFXglyph digital_7__mono_42pt7bRLEGlyphs[] PROGMEM = {
+  {     0,  31,  54,  37,    3,  -53 },   // 0x30 '0'
+  {   125,   6,  54,  37,   28,  -53 },   // 0x31 '1'
+  {   180,  31,  54,  37,    3,  -53 },   // 0x32 '2'
+  {   274,  31,  54,  37,    3,  -53 },   // 0x33 '3'
+  {   375,  31,  54,  37,    3,  -53 },   // 0x34 '4'
+  {   465,  31,  54,  37,    3,  -53 },   // 0x35 '5'
+  {   559,  31,  54,  37,    3,  -53 },   // 0x36 '6'
+  {   670,  31,  54,  37,    3,  -53 },   // 0x37 '7'
+  {   760,  31,  54,  37,    3,  -53 },   // 0x38 '8'
+  {   898,  31,  54,  37,    3,  -53 },   // 0x39 '9'
+  {  1019,   6,  30,  37,   16,  -41 } }; // 0x3A ':'
+
+const GFXrlefont digital_7__mono_42pt7bRLE PROGMEM = {
+  (uint8_t  *)digital_7__mono_42pt7bRLEBitmaps,
+  (GFXglyph *)digital_7__mono_42pt7bRLEGlyphs,
+  0x30, 0x3A, 84 };
+
+// Approx. 1111 bytes
@@ -43,10 +43,10 @@
 #include <WiFiUdp.h>
 #include <ArduinoJson.h>
 #include <TimeLib.h>
-#include <HB9IIU7seg42ptItalic.h> // https://rop.nl/truetype2gfx/ https://fontforge.org/en-US/
+#include <HB9IIU7seg42ptItalicRLE.h> // https://rop.nl/truetype2gfx/ https://fontforge.org/en-US/, RLE by TFT_eSPI/Tools/gfxff2rle
 #include <HB9IIUOrbitronMed8pt.h>
 #include <HB9IIOrbitronMed10pt.h>
-#include <HB9IIU7seg42ptNormal.h>
+#include <HB9IIU7seg42ptNormalRLE.h>
 #include <PNGdec.h>
 #include <SPIFFS.h>
 #include <config.h>
@@ -56,6 +56,10 @@
 #include <FS.h>
 #include <SPIFFS.h>
 #include <WebServer.h>
+#include <new>
+#include <sys/time.h>
+#include <esp32/rtc.h>
+#include <esp32/rom/crc.h>
 
 // Global variables for configuration
 String SSID = WIFI_SSID; // Wi-Fi credentials
@@ -67,6 +71,80 @@ int tOffset = 2; // e.g. 2 = CEST
 // Create web server
 WebServer server(80); // HTTP server on port 80
 
+// The JsonDocuments of the request handlers allocate from this arena, rewound
+// by an ArenaScope at the end of each handler, so serving requests doesn't
+// fragment the heap. Bigger documents spill over to the heap.
+static uint8_t jsonArenaBuffer[4096];
+ArenaAllocator jsonArena(jsonArenaBuffer, sizeof(jsonArenaBuffer));
+
+// Clients that send "Accept: application/msgpack" receive MessagePack instead
+// of JSON, and can POST MessagePack with "Content-Type: application/msgpack"
+static const char msgPackMimeType[] = "application/msgpack";
+static const char *negotiatedHeaders[] = {"Accept", "Content-Type"};
+
+// The body of the current POST request. It's received with server.raw()
+// because server.arg("plain") stops at the first null byte of MessagePack.
+static String requestBody;
+
+static void receiveRequestBody()
+{
+    HTTPRaw &raw = server.raw();
+    if (raw.status == RAW_START)
+        requestBody = "";
+    else if (raw.status == RAW_WRITE)
+        requestBody.concat(reinterpret_cast<const char *>(raw.buf), raw.currentSize);
+}
+
+// Registers a handler for POST requests, which reads the body in requestBody
+static void onPost(const char *uri, WebServer::THandlerFunction handler)
+{
+    server.on(uri, HTTP_POST, [handler]()
+              {
+        handler();
+        requestBody = ""; // keeps the capacity for the next request
+    }, receiveRequestBody);
+}
+
+// True if the request body is MessagePack rather than JSON
+static bool requestIsMsgPack()
+{
+    return server.header("Content-Type").startsWith(msgPackMimeType);
+}
+
+// Parses requestBody as MessagePack or JSON, depending on its Content-Type.
+// With JSON, the strings of doc point into requestBody (see
+// deserializeJsonInPlace()).
+static DeserializationError deserializeRequest(JsonDocument &doc)
+{
+    if (requestIsMsgPack())
+        return deserializeMsgPack(doc, requestBody.c_str(), requestBody.length());
+    return deserializeJsonInPlace(doc, requestBody.begin(), requestBody.length());
+}
+
+// Replies 400 to a body that deserializeRequest() could not parse
+static void sendParseError(DeserializationError error)
+{
+    server.send(400, "text/plain", String("Request parse error: ") + error.c_str());
+}
+
+// Replies with doc as MessagePack if the client accepts it, as JSON otherwise.
+// The length is measured first for the Content-Length header, then the
+// document is serialized straight to the client in blocks, so the response
+// never exists as a whole in RAM.
+static void sendDocument(const JsonDocument &doc)
+{
+    bool msgPack = server.header("Accept").indexOf(msgPackMimeType) >= 0;
+    server.setContentLength(msgPack ? measureMsgPack(doc) : measureJson(doc));
+    server.send(200, msgPack ? msgPackMimeType : "application/json", "");
+
+    WiFiClient client = server.client(); // a copy with arduino-esp32 2.0.x
+    BufferingPrint<256> response(client);
+    if (msgPack)
+        serializeMsgPack(doc, response);
+    else
+        serializeJson(doc, response);
+}
+
 // Configurable Settings (replace all previous #defines)
 float latitude = 46.4667118;
 float longitude = 6.8590456;
@@ -81,7 +159,6 @@ String localTimeLabel = "  QTH Time  ";
 String utcTimeLabel = "  UTC Time  ";
 String startupLogo = "logo1.png";
 bool italicClockFonts = false;
-volatile bool refreshDigits = false;
 const String weatherAPI = "https://api.openweathermap.org/data/2.5/weather"; // OpenWeather API endpoint
 
 int retriesBeforeReboot = 5;
@@ -89,14 +166,53 @@ int retriesBeforeReboot = 5;
 // Global variables for previous time tracking
 String previousLocalTime = "";
 String previousUTCtime = "";
-int refreshDigitsCounter = 0;
 volatile bool refreshFrames = false;
 int refreshFramesCounter = 0;
 
 // TFT Display Setup
 TFT_eSPI tft = TFT_eSPI();                   // Create TFT display object
-TFT_eSprite stext2 = TFT_eSprite(&tft);      // Sprite object for "Hello World" text
-TFT_eSprite progressBar = TFT_eSprite(&tft); // Create sprite for OTA progress bar
+
+// Scrolling banner: the text is only ever bannerColour on black, so it is drawn into a
+// 1-bit sprite (1.2 KB) and expanded band by band into two alternating 16-bit buffers,
+// one band is expanded while the previous one is still being sent by DMA
+#define BANNER_X 5
+#define BANNER_Y 205
+#define BANNER_W 310
+#define BANNER_H 30
+#define BANNER_BAND_H 5 // BANNER_H must be a multiple of this
+TFT_eSprite banner = TFT_eSprite(&tft);
+uint16_t *bannerBandBuf[2];
+bool bannerDMA = false; // DMA engine available, otherwise the sprite is pushed blocking
+
+// Both clock faces (screen rows 0-191) are composed in a 4-bit palettised frame buffer
+// (30 KB, a 16-bit one would not fit next to Wi-Fi without PSRAM). Everything is drawn
+// with palette indices and only the line spans changed since the last push are sent,
+// expanded to RGB565 through the palette, so a new second costs a few digit cells and
+// a colour change is just a palette update
+#define CLOCK_FACE_W 320
+#define CLOCK_FACE_H 192
+#define PAL_BLACK 0
+#define PAL_LOCAL_TIME 1
+#define PAL_UTC_TIME 2
+#define PAL_LOCAL_FRAME 3
+#define PAL_UTC_FRAME 4
+#define PAL_LABEL 5
+TFT_eSprite clockFace = TFT_eSprite(&tft);
+
+// Startup Logo
+// Shown on a cold boot while the display is set up, and at least this long, so
+// that it is seen without delaying the first clock frame much
+#define SPLASH_MIN_MS 300
+
+// OTA Progress Bar
+// Drawn straight to the TFT: only the newly filled columns are pushed, and only
+// when the integer percentage changes (onProgress fires for every received chunk)
+#define OTA_BAR_X 10
+#define OTA_BAR_Y 140
+#define OTA_BAR_W 300
+#define OTA_BAR_H 30
+int otaPercent = -1; // Last percentage drawn
+int otaBarWidth = 0; // Columns already filled
 
 // Scrolling Text
 int textX;                                                                                      // Variable for text position (to start at the rightmost side)
@@ -110,9 +226,159 @@ NTPClient timeClient(ntpUDP, "pool.ntp.org", 0, 60000); // UTC offset and update
 
 // WiFi Reconnect Logic
 int retryCount = 0;
+unsigned long wifiStartMillis = 0; // When association was started
+bool networkStarted = false;       // OTA, mDNS, web server and NTP are running
+
+// Any system time before this (2023-11-14) means the clock has never been set
+#define MIN_VALID_EPOCH 1700000000
+
+// Last weather report, kept so it can be restored after a warm restart
+struct WeatherData
+{
+    float temp;
+    int humidity;
+    long dt;
+    long sunrise;
+    long sunset;
+    char name[32];
+    char country[4];
+    char description[48];
+};
+WeatherData lastWeather = {};
+
+// Everything fetchWeatherData() reads from the OpenWeather response
+struct WeatherReport
+{
+    float lon, lat;
+    int weatherId;
+    char weatherMain[16];
+    char weatherDescription[48];
+    char weatherIcon[8];
+    char base[16];
+    float temp, feels_like, temp_min, temp_max;
+    int pressure, humidity, sea_level, grnd_level;
+    int visibility;
+    float wind_speed;
+    int wind_deg;
+    float wind_gust;
+    float rain_1h;
+    int clouds_all;
+    long dt;
+    int sys_type, sys_id;
+    char sys_country[4];
+    long sunrise, sunset;
+    int timezone;
+    long id;
+    char name[32];
+    int cod;
+};
+WeatherReport weatherReport;
+
+// JSON path of each member, the response is parsed straight into weatherReport
+// in one pass, without building a JsonDocument
+constexpr JsonField weatherFields[] = {
+    {"/coord/lon", weatherReport.lon},
+    {"/coord/lat", weatherReport.lat},
+    {"/weather/0/id", weatherReport.weatherId},
+    {"/weather/0/main", weatherReport.weatherMain},
+    {"/weather/0/description", weatherReport.weatherDescription},
+    {"/weather/0/icon", weatherReport.weatherIcon},
+    {"/base", weatherReport.base},
+    {"/main/temp", weatherReport.temp},
+    {"/main/feels_like", weatherReport.feels_like},
+    {"/main/temp_min", weatherReport.temp_min},
+    {"/main/temp_max", weatherReport.temp_max},
+    {"/main/pressure", weatherReport.pressure},
+    {"/main/humidity", weatherReport.humidity},
+    {"/main/sea_level", weatherReport.sea_level},
+    {"/main/grnd_level", weatherReport.grnd_level},
+    {"/visibility", weatherReport.visibility},
+    {"/wind/speed", weatherReport.wind_speed},
+    {"/wind/deg", weatherReport.wind_deg},
+    {"/wind/gust", weatherReport.wind_gust},
+    {"/rain/1h", weatherReport.rain_1h},
+    {"/clouds/all", weatherReport.clouds_all},
+    {"/dt", weatherReport.dt},
+    {"/sys/type", weatherReport.sys_type},
+    {"/sys/id", weatherReport.sys_id},
+    {"/sys/country", weatherReport.sys_country},
+    {"/sys/sunrise", weatherReport.sunrise},
+    {"/sys/sunset", weatherReport.sunset},
+    {"/timezone", weatherReport.timezone},
+    {"/id", weatherReport.id},
+    {"/name", weatherReport.name},
+    {"/cod", weatherReport.cod},
+};
+
+// Warm-restart snapshot
+// Kept in RTC slow memory so that after a software reset (saveSettings(), OTA,
+// Wi-Fi give-up) the clock and the banner resume instantly instead of waiting
+// for Wi-Fi, NTP and OpenWeather. The RTC timer keeps counting across such
+// resets, so it is the time reference (millis() restarts from zero).
+#define WARM_SNAPSHOT_MAGIC 0x48425753 // "HBWS"
+#define WARM_SNAPSHOT_TEXT_LEN 256
+#define DRIFT_MIN_INTERVAL_US (3600ULL * 1000000ULL) // Shortest span used to estimate drift
+
+struct WarmSnapshot
+{
+    uint32_t magic;
+    int64_t epoch;    // UTC epoch at the last NTP sync (0 = never synced)
+    uint64_t rtcUs;   // RTC timer at the same instant
+    int32_t driftPpm; // RTC timer drift measured between NTP syncs
+    bool hasWeather;
+    WeatherData weather;
+    char scrollText[WARM_SNAPSHOT_TEXT_LEN];
+    uint32_t crc; // CRC32 of everything above, must stay last
+};
+
+RTC_NOINIT_ATTR WarmSnapshot warmSnapshot;
+
+// Boot Profiler
+// Each boot is recorded as a list of named phases with microsecond timings.
+// The last BOOT_TRACE_HISTORY traces are kept in RTC memory (survives software
+// resets and OTA reboots, not power cycles) and are served as JSON on /boottrace.
+#define BOOT_TRACE_MAGIC 0x48423954 // "HB9T"
+#define BOOT_TRACE_HISTORY 4
+#define BOOT_TRACE_MAX_PHASES 16
+#define BOOT_PHASE_NAME_LEN 12
+
+struct BootPhase
+{
+    char name[BOOT_PHASE_NAME_LEN];
+    uint32_t startUs;    // Relative to the start of setup()
+    uint32_t durationUs;
+};
+
+struct BootTrace
+{
+    uint32_t bootNumber;
+    uint32_t setupStartUs; // micros() when setup() started (ROM + bootloader time)
+    uint32_t totalUs;      // 0 while the boot is still in progress
+    uint8_t resetReason;   // esp_reset_reason_t
+    uint8_t phaseCount;
+    BootPhase phases[BOOT_TRACE_MAX_PHASES];
+};
+
+struct BootTraceStore
+{
+    uint32_t magic;
+    uint32_t bootCount;
+    uint8_t current; // Index of the trace being recorded
+    BootTrace traces[BOOT_TRACE_HISTORY];
+};
+
+RTC_NOINIT_ATTR BootTraceStore bootTraceStore;
+uint32_t bootPhaseStartUs = 0;
+bool bootProfilerDone = false;
 
 // Function Prototypes
-void connectWiFi();
+void startWiFi();
+void serviceNetworkBoot();
+void startNetworkServices();
+bool getCurrentEpoch(time_t &epoch);
+bool restoreWarmSnapshot();
+void saveWarmSnapshot();
+void recordNtpSync(time_t epoch);
 void fetchWeatherData();
 String formatLocalTime(long epochTime);
 String convertEpochToTimeString(long epochTime);
@@ -122,9 +388,19 @@ void loadSettings();
 void handleRoot();
 void handleSave();
 void drawOrredrawStaticElements();
+void bootProfilerBegin();
+void bootPhase(const char *name);
+void bootProfilerEnd();
+void handleBootTrace();
+void drawOtaProgress(unsigned int progress, unsigned int total);
+void drawBanner();
+void updateClockPalette();
 
 // PNG Decoder Setup
-PNG png;
+// The decoder context is ~45 kB (mostly the 32 kB zlib window) and is only
+// needed while the splash screen is drawn, so it is allocated on the heap
+// for the duration of displayPNGfromSPIFFS() and released afterwards.
+PNG *png = nullptr;
 fs::File pngFile; // Global File handle (required for PNGdec callbacks)
 
 // Callback functions for PNGdec
@@ -140,14 +416,23 @@ void setup()
     // Start Serial Monitor
     Serial.begin(115200);
     Serial.println("Starting setup...");
+    bootProfilerBegin();
+    bool warmBoot = restoreWarmSnapshot(); // Last known time and weather after a software reset
     // 🔧 Mount SPIFFS
     if (!SPIFFS.begin(true))
     {
         Serial.println("❌ SPIFFS mount failed!");
         return;
     }
+    bootPhase("spiffs");
+
+    // 📶 Start associating now: it completes in the background while the display is set up
+    startWiFi();
+    bootPhase("wifi start");
+
     // Load saved settings first
     loadSettings();
+    bootPhase("settings");
     // saveSettings();
     //  bannerSpeed=40;
     //   Initialize TFT display
@@ -155,13 +440,61 @@ void setup()
     tft.setRotation(1);
     tft.fillScreen(TFT_BLACK);
     Serial.println("TFT Display initialized!");
+    bootPhase("tft");
 
-    // Display PNG from SPIFFS
-    displayPNGfromSPIFFS(startupLogo.c_str(), 0);
+    // Display PNG from SPIFFS, on a cold boot only: after a software reset the clock resumes at once
+    unsigned long splashMillis = 0;
+    if (!warmBoot)
+    {
+        displayPNGfromSPIFFS(startupLogo.c_str(), 0);
+        splashMillis = millis();
+        bootPhase("splash");
+    }
 
-    // Connect to Wi-Fi
-    connectWiFi();
+    // Clock face frame buffer, allocated before the banner bands while the heap is unfragmented
+    clockFace.setColorDepth(4);
+    if (clockFace.createSprite(CLOCK_FACE_W, CLOCK_FACE_H) == nullptr || !clockFace.setDirtyTracking(true))
+    {
+        Serial.println("❌ Clock face frame buffer allocation failed!");
+    }
+    updateClockPalette();
+
+    // Create the 1-bit sprite for the Weather text and the DMA band buffers (internal RAM, no PSRAM on the CYD)
+    banner.setColorDepth(1);
+    banner.createSprite(BANNER_W, BANNER_H);
+    banner.setTextDatum(TL_DATUM);              // Top-left alignment for text
+    banner.setFreeFont(&Orbitron_Medium10pt7b); // Apply custom font to the sprite
+    bannerDMA = tft.initDMA();
+    for (int i = 0; i < 2; i++)
+    {
+        bannerBandBuf[i] = (uint16_t *)malloc(BANNER_W * BANNER_BAND_H * sizeof(uint16_t));
+        if (bannerBandBuf[i] == nullptr) bannerDMA = false;
+    }
+
+    // Calculate the initial position (rightmost position)
+    textX = BANNER_W;
+    bootPhase("sprites");
 
+    // Keep the startup logo up for SPLASH_MIN_MS; Wi-Fi keeps associating in the background
+    if (!warmBoot)
+    {
+        while (millis() - splashMillis < SPLASH_MIN_MS)
+        {
+            delay(10);
+        }
+        bootPhase("splash hold");
+    }
+
+    // Clock face replaces the logo; digits follow on the first loop() from the last known time
+    tft.fillScreen(TFT_BLACK);
+    drawOrredrawStaticElements();
+    clockFace.pushDirty(0, 0);
+    bootPhase("clock face");
+}
+
+// 🌐 Start OTA, mDNS, the web server, NTP and the first weather fetch (needs Wi-Fi)
+void startNetworkServices()
+{
     // Start OTA
     ArduinoOTA.setHostname("hb9iiuhamclock"); // 🧠 Make sure OTA uses the same hostname
 
@@ -177,77 +510,14 @@ void setup()
     tft.setFreeFont(&Orbitron_Light_32);
     tft.drawCentreString("Receiving New", 160, 10, 1); 
     tft.setTextColor(TFT_RED, TFT_BLACK);
-    tft.drawCentreString(type, 160, 70, 1); });
-
-    ArduinoOTA.onProgress([](unsigned int progress, unsigned int total)
-                          {
-                              int percent = (progress * 100) / total;
-                              Serial.printf("Progress: %u%%\r", percent);
-
-                              // Clear the sprite
-                              progressBar.fillSprite(TFT_DARKGREY);
-
-                              // Draw filled portion
-                              int barWidth = map(percent, 0, 100, 0, 300);
-                              progressBar.fillRect(0, 0, barWidth, 30, TFT_GREEN);
-
-                              // Optional: Draw percent text
-                              char buf[16];
-                              sprintf(buf, "%d%%", percent);
-                              progressBar.setTextDatum(CC_DATUM);
-                              ArduinoOTA.onProgress([](unsigned int progress, unsigned int total)
-                                                    {
-                                                        int percent = (progress * 100) / total;
-                                                        Serial.printf("Progress: %u%%\r", percent);
-
-                                                        // Clear the sprite
-                                                        progressBar.fillSprite(TFT_DARKGREY);
-
-                                                        // Draw filled portion
-                                                        int barWidth = map(percent, 0, 100, 0, 300);
-                                                        progressBar.fillRect(0, 0, barWidth, 30, TFT_GREEN);
-
-                                                        // Optional: Draw percent text
-                                                        char buf[16];
-                                                        sprintf(buf, "%d%%", percent);
-                                                        progressBar.setTextDatum(CC_DATUM);
-                                                        progressBar.setTextColor(TFT_WHITE, TFT_DARKGREY);
-                                                        ArduinoOTA.onProgress([](unsigned int progress, unsigned int total)
-                                                                              {
-                                                                                  int percent = (progress * 100) / total;
-                                                                                  Serial.printf("Progress: %u%%\r", percent);
-
-                                                                                  // Clear the sprite
-                                                                                  progressBar.fillSprite(TFT_DARKGREY);
-
-                                                                                  // Draw filled portion
-                                                                                  int barWidth = map(percent, 0, 100, 0, 300);
-                                                                                  progressBar.fillRect(0, 0, barWidth, 30, TFT_GREEN);
-
-                                                                                  // Optional: Draw percent text
-                                                                                  char buf[16];
-                                                                                  sprintf(buf, "%d%%", percent);
-                                                                                  progressBar.setTextDatum(CC_DATUM);
-                                                                                  progressBar.setTextSize(2);
-                                                                                  progressBar.setTextColor(TFT_BLACK);
-
-                                                                                  progressBar.drawString(buf, 150, 15); // Centered
-
-                                                                                  // Push to screen
-                                                                                  progressBar.pushSprite(10, 140); // Position on screen
-                                                                              });
-
-                                                        progressBar.drawString(buf, 150, 15); // Centered
-
-                                                        // Push to screen
-                                                        progressBar.pushSprite(10, 140); // Position on screen
-                                                    });
-
-                              progressBar.drawString(buf, 150, 15); // Centered
-
-                              // Push to screen
-                              progressBar.pushSprite(10, 140); // Position on screen
-                          });
+    tft.drawCentreString(type, 160, 70, 1);
+
+    // Empty progress bar, filled in incrementally by drawOtaProgress()
+    otaPercent = -1;
+    otaBarWidth = 0;
+    tft.fillRect(OTA_BAR_X, OTA_BAR_Y, OTA_BAR_W, OTA_BAR_H, TFT_DARKGREY); });
+
+    ArduinoOTA.onProgress(drawOtaProgress);
 
     ArduinoOTA.onEnd([]()
                      {
@@ -380,6 +650,7 @@ void setup()
     {
         Serial.println("🌍 mDNS started successfully. You can access via http://hb9iiuhamclock.local");
     }
+    bootPhase("ota+mdns");
 
     // Start Web Server
     server.on("/", handleRoot);                       // Serve the HTML page
@@ -395,7 +666,8 @@ void setup()
 
     server.on("/config", HTTP_GET, []()
               {
-  StaticJsonDocument<1024> doc;
+  ArenaScope jsonScope(jsonArena);
+  JsonDocument doc(&jsonArena);
 
   doc["latitude"] = latitude;
   doc["longitude"] = longitude;
@@ -411,25 +683,24 @@ void setup()
   doc["startupLogo"] = startupLogo;
   doc["italicClockFonts"] = italicClockFonts;
 
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response); });
+  sendDocument(doc); });
 
     server.on("/scrolltext", []()
               { server.send(200, "text/plain", scrollText); });
 
-    server.on("/setcolor", HTTP_POST, []()
+    onPost("/setcolor", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         return;
     }
 
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
 
     if (error) {
-        server.send(400, "text/plain", "JSON parse error");
+        sendParseError(error);
         return;
     }
 
@@ -467,22 +738,23 @@ if (target == "doubleFrame") {
         return;
     }
 
-    drawOrredrawStaticElements();
-    refreshDigits = true;
+    // Recolours the clock faces in place, the next loop() pushes them
+    updateClockPalette();
 
     server.send(200, "text/plain", "OK"); });
 
-    server.on("/setspeed", HTTP_POST, []()
+    onPost("/setspeed", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         return;
     }
 
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
     if (error) {
-        server.send(400, "text/plain", "JSON parse error");
+        sendParseError(error);
         return;
     }
 
@@ -494,17 +766,18 @@ if (target == "doubleFrame") {
     server.send(200, "text/plain", "OK"); });
 
     // ESP32 WebServer endpoint for setting labels without saving
-    server.on("/setlabel", HTTP_POST, []()
+    onPost("/setlabel", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         return;
     }
 
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
     if (error) {
-        server.send(400, "text/plain", "JSON parse error");
+        sendParseError(error);
         return;
     }
 
@@ -528,23 +801,24 @@ if (target == "doubleFrame") {
 
     server.send(200, "text/plain", "OK"); });
 
-    server.on("/setposition", HTTP_POST, []()
+    onPost("/setposition", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         Serial.println("⚠️ No body received");
         return;
     }
 
-    String body = server.arg("plain");
-    Serial.println("📩 Received JSON:");
-    Serial.println(body);  // 🔍 Print raw incoming JSON for debugging
+    Serial.println("📩 Received request:");
+    if (!requestIsMsgPack())
+        Serial.println(requestBody);  // 🔍 Print the raw body for debugging
 
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, body);
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
     if (error) {
-        Serial.println("❌ JSON parse error");
-        server.send(400, "text/plain", "JSON parse error");
+        Serial.printf("❌ Request parse error: %s\n", error.c_str());
+        sendParseError(error);
         return;
     }
 
@@ -564,17 +838,18 @@ if (target == "doubleFrame") {
 
     server.send(200, "text/plain", "OK"); });
 
-    server.on("/setitalic", HTTP_POST, []()
+    onPost("/setitalic", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         return;
     }
 
-    StaticJsonDocument<128> doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
     if (error) {
-        server.send(400, "text/plain", "JSON parse error");
+        sendParseError(error);
         return;
     }
 
@@ -593,19 +868,20 @@ if (target == "doubleFrame") {
     saveSettings();
     server.send(200, "text/plain", "💾 Settings saved to flash"); });
 
-    server.on("/setbootimage", HTTP_POST, []()
+    onPost("/setbootimage", []()
               {
-                  if (!server.hasArg("plain"))
+                  if (requestBody.isEmpty())
                   {
                       server.send(400, "text/plain", "Missing body");
                       return;
                   }
 
-                  StaticJsonDocument<256> doc;
-                  DeserializationError error = deserializeJson(doc, server.arg("plain"));
+                  ArenaScope jsonScope(jsonArena);
+                  JsonDocument doc(&jsonArena);
+                  DeserializationError error = deserializeRequest(doc);
                   if (error)
                   {
-                      server.send(400, "text/plain", "JSON parse error");
+                      sendParseError(error);
                       return;
                   }
 
@@ -622,17 +898,18 @@ if (target == "doubleFrame") {
                   saveSettings(); // 💾 Persist the change
               });
 
-    server.on("/setbootimage", HTTP_POST, []()
+    onPost("/setbootimage", []()
               {
-    if (!server.hasArg("plain")) {
+    if (requestBody.isEmpty()) {
         server.send(400, "text/plain", "Missing body");
         return;
     }
 
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    DeserializationError error = deserializeRequest(doc);
     if (error) {
-        server.send(400, "text/plain", "JSON parse error");
+        sendParseError(error);
         return;
     }
 
@@ -648,66 +925,80 @@ if (target == "doubleFrame") {
 
     server.send(200, "text/plain", "Boot logo saved"); });
 
+    server.on("/boottrace", HTTP_GET, handleBootTrace);
+
+    server.collectHeaders(negotiatedHeaders, 2);
     server.begin();
+    bootPhase("routes");
 
     // Initialize NTP Client
     timeClient.begin();
     timeClient.setTimeOffset(0); // UTC Offset (0 for UTC)
     Serial.println("NTP Client initialized.");
-    tft.fillScreen(TFT_BLACK);
+    bootPhase("ntp");
 
     fetchWeatherData();
-
-    drawOrredrawStaticElements();
-
-    // Create a sprite for the Weather text
-    progressBar.setColorDepth(8);      // Use 8-bit color for efficiency
-    progressBar.createSprite(300, 30); // Width and height of the bar
-
-    stext2.setColorDepth(8);
-    stext2.createSprite(310, 30);      // Create a 310x20 sprite to accommodate the text width
-    stext2.setTextColor(bannerColour); // White text
-    stext2.setTextDatum(TL_DATUM);     // Top-left alignment for text
-
-    // Set the font for the sprite
-    stext2.setFreeFont(&Orbitron_Medium10pt7b); // Apply custom font to the sprite
-
-    // Calculate the initial position (rightmost position)
-    textX = stext2.width();
+    bootPhase("weather");
 }
 
 void loop()
 {
-    ArduinoOTA.handle();
-    server.handleClient(); // ⬅️ Serve HTTP requests
+    serviceNetworkBoot(); // Brings up the network services once Wi-Fi has associated
+    if (networkStarted)
+    {
+        ArduinoOTA.handle();
+        server.handleClient(); // ⬅️ Serve HTTP requests
+    }
     // Calculate time elapsed since last weather data fetch
     unsigned long currentMillis = millis();
     static unsigned long previousMillis = 0; // Store the last time the weather data was fetched
 
     // Update time every second
-    timeClient.update();
-
-    // Get Local Time by adding tOffset to UTC time
-    long localEpoch = timeClient.getEpochTime() + (tOffset * 3600); // Add offset (in seconds)
-    String localTime = formatLocalTime(localEpoch);                 // Format the local time
-
-    // Get UTC Time
-    String utcTime = timeClient.getFormattedTime();
-
-    // Display Local and UTC Time with different y positions
-    tft.setTextColor(TFT_WHITE); // Set text color to white
-    if (italicClockFonts)
+    if (networkStarted && timeClient.update())
     {
-        tft.setFreeFont(&digital_7_monoitalic42pt7b);
+        // Keep the system clock and the warm-restart snapshot in step with NTP
+        recordNtpSync((time_t)timeClient.getEpochTime());
     }
-    else
+
+    time_t utcEpoch;
+    if (getCurrentEpoch(utcEpoch))
     {
-        tft.setFreeFont(&digital_7__mono_42pt7b);
+        // Get Local Time by adding tOffset to UTC time
+        long localEpoch = utcEpoch + (tOffset * 3600); // Add offset (in seconds)
+        String localTime = formatLocalTime(localEpoch); // Format the local time
+
+        // Get UTC Time
+        String utcTime = formatLocalTime(utcEpoch);
+
+        // Draw Local and UTC Time into the clock face frame buffer with different y positions
+        if (italicClockFonts)
+        {
+            clockFace.setFreeFontRLE(&digital_7_monoitalic42pt7bRLE);
+        }
+        else
+        {
+            clockFace.setFreeFontRLE(&digital_7__mono_42pt7bRLE);
+        }
+        // Corrected y positions for both clocks
+        displayTime(8, 5, localTime, previousLocalTime, 0, PAL_LOCAL_TIME); // Display local time at y = 5
+
+        displayTime(10, 107, utcTime, previousUTCtime, 0, PAL_UTC_TIME); // Display UTC time at y = 106
+
+        static bool clockShown = false;
+        if (!clockShown)
+        {
+            clockShown = true;
+            bootPhase("clock"); // First digits on screen (possibly last known time)
+        }
+        if (!bootProfilerDone && networkStarted && timeClient.isTimeSet())
+        {
+            bootPhase("first time"); // First correct time is on screen: boot is complete
+            bootProfilerEnd();
+        }
     }
-    // Corrected y positions for both clocks
-    displayTime(8, 5, localTime, previousLocalTime, 0, localTimeColour); // Display local time at y = 5
 
-    displayTime(10, 107, utcTime, previousUTCtime, 0, utcTimeColour); // Display UTC time at y = 106
+    // Send what changed in the clock faces: digits, and frames, labels or colours set from the web page
+    clockFace.pushDirty(0, 0);
 
     // Fetch Weather Data once every 5 minutes
     if (currentMillis - previousMillis >= 1000 * 60 * 5)
@@ -721,31 +1012,25 @@ void loop()
         // Save the last time the action was performed
         previousMillisForScroller = currentMillis;
 
-        // Clear the sprite
-        stext2.fillSprite(TFT_BLACK); // Fill sprite with background color
-
-        // Draw the text inside the sprite at the specified position
-        stext2.setTextColor(bannerColour);
-        stext2.drawString(scrollText, textX, 0); // Draw text in sprite at position `textX`
+        // Draw the text at `textX` and push it to the screen band by band
+        drawBanner();
 
         // Scroll the text by shifting the position to the left
         textX -= 1; // Move text left by 1 pixel
 
         // Reset position when text has scrolled off the screen
-        if (textX < -stext2.textWidth(scrollText))
-        {                           // Text has completely scrolled off screen
-            textX = stext2.width(); // Reset position to the far right
+        if (textX < -banner.textWidth(scrollText))
+        {                     // Text has completely scrolled off screen
+            textX = BANNER_W; // Reset position to the far right
         }
-
-        // Push the sprite onto the TFT at the specified coordinates
-        stext2.pushSprite(5, 205); // Push the sprite to the screen at position (5, 220)
     }
 }
 
-// 📶 Function to connect to Wi-Fi and initialize mDNS
-void connectWiFi()
+// 📶 Start Wi-Fi association without waiting for it to complete
+void startWiFi()
 {
     // Set a custom hostname BEFORE connecting to Wi-Fi
+    WiFi.mode(WIFI_STA);
     WiFi.setHostname("hb9iiuhamclock");
     String hostname = WiFi.getHostname();
 
@@ -756,11 +1041,31 @@ void connectWiFi()
     Serial.println(hostname);
 
     WiFi.begin(SSID, WiFiPassword);
+    wifiStartMillis = millis();
+}
 
-    // Attempt to connect, retrying with a delay
-    while (WiFi.status() != WL_CONNECTED)
+// 📶 Called from loop(): starts the network services once associated, reboots if it never happens
+void serviceNetworkBoot()
+{
+    if (networkStarted)
+        return;
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+        Serial.println("✅ Wi-Fi connected!");
+        Serial.print("📶 IP Address: ");
+        Serial.println(WiFi.localIP());
+        bootPhase("wifi");
+
+        networkStarted = true;
+        startNetworkServices();
+        return;
+    }
+
+    // Same budget as the former blocking loop: one retry per second
+    unsigned long waited = millis() - wifiStartMillis;
+    if (waited >= (unsigned long)(retryCount + 1) * 1000)
     {
-        delay(1000);
         Serial.println("⏳ Waiting for Wi-Fi connection...");
         retryCount++;
 
@@ -770,10 +1075,19 @@ void connectWiFi()
             ESP.restart();
         }
     }
+}
 
-    Serial.println("✅ Wi-Fi connected!");
-    Serial.print("📶 IP Address: ");
-    Serial.println(WiFi.localIP());
+// Best available UTC time: NTP once synchronised, otherwise the system clock
+// (it keeps running across software resets) if it holds a plausible date
+bool getCurrentEpoch(time_t &epoch)
+{
+    if (networkStarted && timeClient.isTimeSet())
+    {
+        epoch = timeClient.getEpochTime();
+        return true;
+    }
+    epoch = time(nullptr);
+    return epoch >= MIN_VALID_EPOCH;
 }
 
 // Fetch weather data
@@ -796,166 +1110,123 @@ void fetchWeatherData()
         Serial.println(payload);
         Serial.println("Weather data received.");
 
-        // Parse the JSON response
-        DynamicJsonDocument doc(1024);
-        deserializeJson(doc, payload);
-
-        // Extracting values from the JSON response and assigning to variables
-
-        // Coordinates
-        float lon = doc["coord"]["lon"];
-        float lat = doc["coord"]["lat"];
-
-        // Weather
-        int weatherId = doc["weather"][0]["id"];
-        const char *weatherMain = doc["weather"][0]["main"];
-        const char *weatherDescription = doc["weather"][0]["description"];
-        const char *weatherIcon = doc["weather"][0]["icon"];
-
-        // Base
-        const char *base = doc["base"];
-
-        // Main weather data
-        float temp = doc["main"]["temp"];
-        float feels_like = doc["main"]["feels_like"];
-        float temp_min = doc["main"]["temp_min"];
-        float temp_max = doc["main"]["temp_max"];
-        int pressure = doc["main"]["pressure"];
-        int humidity = doc["main"]["humidity"];
-        int sea_level = doc["main"]["sea_level"];
-        int grnd_level = doc["main"]["grnd_level"];
-
-        // Visibility
-        int visibility = doc["visibility"];
-
-        // Wind data
-        float wind_speed = doc["wind"]["speed"];
-        int wind_deg = doc["wind"]["deg"];
-        float wind_gust = doc["wind"]["gust"];
-
-        // Rain data
-        float rain_1h = doc["rain"]["1h"];
-
-        // Clouds data
-        int clouds_all = doc["clouds"]["all"];
-
-        // Date/Time
-        long dt = doc["dt"];
-
-        // System data
-        int sys_type = doc["sys"]["type"];
-        int sys_id = doc["sys"]["id"];
-        const char *sys_country = doc["sys"]["country"];
-        long sunrise = doc["sys"]["sunrise"];
-        long sunset = doc["sys"]["sunset"];
-
-        // Timezone
-        int timezone = doc["timezone"];
-
-        // Location data
-        int id = doc["id"];
-        const char *name = doc["name"];
-
-        // Status code
-        int cod = doc["cod"];
+        // Parse the JSON response, fields missing from it read as zero
+        weatherReport = WeatherReport();
+        DeserializationError error = deserializeJson(weatherFields, payload);
+        if (error)
+        {
+            Serial.print("⚠️ Weather response: ");
+            Serial.println(error.c_str());
+        }
+        const WeatherReport &w = weatherReport;
 
         // Print the extracted values
         Serial.println("Weather data received.");
         Serial.print("Coordinates: ");
         Serial.print("Longitude: ");
-        Serial.print(lon);
+        Serial.print(w.lon);
         Serial.print(", Latitude: ");
-        Serial.println(lat);
+        Serial.println(w.lat);
 
         Serial.print("Weather ID: ");
-        Serial.println(weatherId);
+        Serial.println(w.weatherId);
         Serial.print("Main: ");
-        Serial.println(weatherMain);
+        Serial.println(w.weatherMain);
         Serial.print("Description: ");
-        Serial.println(weatherDescription);
+        Serial.println(w.weatherDescription);
         Serial.print("Icon: ");
-        Serial.println(weatherIcon);
+        Serial.println(w.weatherIcon);
 
         Serial.print("Base: ");
-        Serial.println(base);
+        Serial.println(w.base);
 
         Serial.print("Temperature: ");
-        Serial.println(temp);
+        Serial.println(w.temp);
         Serial.print("Feels like: ");
-        Serial.println(feels_like);
+        Serial.println(w.feels_like);
         Serial.print("Min Temp: ");
-        Serial.println(temp_min);
+        Serial.println(w.temp_min);
         Serial.print("Max Temp: ");
-        Serial.println(temp_max);
+        Serial.println(w.temp_max);
         Serial.print("Pressure: ");
-        Serial.println(pressure);
+        Serial.println(w.pressure);
         Serial.print("Humidity: ");
-        Serial.println(humidity);
+        Serial.println(w.humidity);
         Serial.print("Sea level: ");
-        Serial.println(sea_level);
+        Serial.println(w.sea_level);
         Serial.print("Ground level: ");
-        Serial.println(grnd_level);
+        Serial.println(w.grnd_level);
 
         Serial.print("Visibility: ");
-        Serial.println(visibility);
+        Serial.println(w.visibility);
 
         Serial.print("Wind speed: ");
-        Serial.println(wind_speed);
+        Serial.println(w.wind_speed);
         Serial.print("Wind degree: ");
-        Serial.println(wind_deg);
+        Serial.println(w.wind_deg);
         Serial.print("Wind gust: ");
-        Serial.println(wind_gust);
+        Serial.println(w.wind_gust);
 
         Serial.print("Rain 1h: ");
-        Serial.println(rain_1h);
+        Serial.println(w.rain_1h);
 
         Serial.print("Clouds: ");
-        Serial.println(clouds_all);
+        Serial.println(w.clouds_all);
 
         Serial.print("Timestamp: ");
-        Serial.println(dt);
+        Serial.println(w.dt);
 
         Serial.print("System type: ");
-        Serial.println(sys_type);
+        Serial.println(w.sys_type);
         Serial.print("System ID: ");
-        Serial.println(sys_id);
+        Serial.println(w.sys_id);
         Serial.print("Country: ");
-        Serial.println(sys_country);
+        Serial.println(w.sys_country);
         Serial.print("Sunrise: ");
-        Serial.println(sunrise);
+        Serial.println(w.sunrise);
         Serial.print("Sunset: ");
-        Serial.println(sunset);
+        Serial.println(w.sunset);
 
         Serial.print("Timezone: ");
-        Serial.println(timezone);
+        Serial.println(w.timezone);
 
         Serial.print("Location ID: ");
-        Serial.println(id);
+        Serial.println(w.id);
         Serial.print("Location Name: ");
-        Serial.println(name);
+        Serial.println(w.name);
 
         Serial.print("Status code: ");
-        Serial.println(cod);
+        Serial.println(w.cod);
 
         // Convert sunrise and sunset times to local time
-        long localSunrise = sunrise + (tOffset * 3600); // Adjust for local time (seconds)
-        long localSunset = sunset + (tOffset * 3600);   // Adjust for local time (seconds)
+        long localSunrise = w.sunrise + (tOffset * 3600); // Adjust for local time (seconds)
+        long localSunset = w.sunset + (tOffset * 3600);   // Adjust for local time (seconds)
 
         // Convert sunrise and sunset times to human-readable format
         String sunriseTime = convertEpochToTimeString(localSunrise);
         String sunsetTime = convertEpochToTimeString(localSunset);
-        String date = convertTimestampToDate(dt); // Convert to DD:MM:YY format
+        String date = convertTimestampToDate(w.dt); // Convert to DD:MM:YY format
         // Build the scrollText with the date, weather, sunrise, and sunset times
-        scrollText = String(name) + "     " + sys_country + "    " +
+        scrollText = String(w.name) + "     " + w.sys_country + "    " +
                      date + "     " +
-                     "Temp: " + String(temp, 1) + "°C     " + // One decimal place for temp
-                     "RH: " + String(humidity) + "%" + "       " +
-                     String(weatherDescription) + "       " +
+                     "Temp: " + String(w.temp, 1) + "°C     " + // One decimal place for temp
+                     "RH: " + String(w.humidity) + "%" + "       " +
+                     String(w.weatherDescription) + "       " +
                      "Sunrise: " + sunriseTime + "     " +
                      "Sunset: " + sunsetTime;
 
-        stext2.drawString(scrollText, textX, 0); // Draw text in sprite at position `textX`
-        textX = stext2.width();
+        lastWeather.temp = w.temp;
+        lastWeather.humidity = w.humidity;
+        lastWeather.dt = w.dt;
+        lastWeather.sunrise = w.sunrise;
+        lastWeather.sunset = w.sunset;
+        strlcpy(lastWeather.name, w.name, sizeof(lastWeather.name));
+        strlcpy(lastWeather.country, w.sys_country, sizeof(lastWeather.country));
+        strlcpy(lastWeather.description, w.weatherDescription, sizeof(lastWeather.description));
+        warmSnapshot.hasWeather = true;
+        saveWarmSnapshot();
+
+        textX = BANNER_W;
         Serial.println(scrollText);
     }
     else
@@ -963,12 +1234,75 @@ void fetchWeatherData()
         Serial.print("Error fetching weather data, HTTP code: ");
         Serial.println(httpCode);
         scrollText = "Sorry, No Weather Info At This Moment!!!"; // Text to scroll
-        textX = stext2.width();
+        textX = BANNER_W;
     }
 
     http.end();
 }
 
+// Render the banner text at textX into the 1-bit sprite, then send it one band at a time.
+// pushImageDMA() waits for the previous transfer before starting the next, so when a band
+// buffer is expanded into again its earlier DMA transfer has completed; endWrite() waits
+// for the last one
+void drawBanner()
+{
+    banner.fillSprite(0);
+    banner.setTextColor(1); // Set bits, coloured by setBitmapColor()
+    banner.drawString(scrollText, textX, 0);
+    banner.setBitmapColor(bannerColour, TFT_BLACK);
+
+    if (!bannerDMA)
+    {
+        banner.pushSprite(BANNER_X, BANNER_Y);
+        return;
+    }
+
+    bool swapBytes = tft.getSwapBytes();
+    tft.setSwapBytes(false); // Expanded pixels are already in display byte order
+    tft.startWrite();        // Chip select stays low for the whole banner
+
+    int sel = 0;
+    for (int top = 0; top < BANNER_H; top += BANNER_BAND_H)
+    {
+        banner.expandLines(top, BANNER_BAND_H, bannerBandBuf[sel]);
+        tft.pushImageDMA(BANNER_X, BANNER_Y + top, BANNER_W, BANNER_BAND_H, bannerBandBuf[sel]);
+        sel ^= 1;
+    }
+
+    tft.endWrite();
+    tft.setSwapBytes(swapBytes);
+}
+
+// OTA progress callback: cheap early return unless the integer percentage changed
+void drawOtaProgress(unsigned int progress, unsigned int total)
+{
+    if (total == 0)
+        return;
+
+    int percent = (int)((uint64_t)progress * 100 / total);
+    if (percent == otaPercent)
+        return;
+    otaPercent = percent;
+    Serial.printf("Progress: %u%%\r", percent);
+
+    // Only the columns gained since the last update
+    int barWidth = percent * OTA_BAR_W / 100;
+    if (barWidth > otaBarWidth)
+    {
+        tft.fillRect(OTA_BAR_X + otaBarWidth, OTA_BAR_Y, barWidth - otaBarWidth, OTA_BAR_H, TFT_GREEN);
+        otaBarWidth = barWidth;
+    }
+
+    // Percentage below the bar, padded so the previous value is overwritten in the same pass
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%d%%", percent);
+    tft.setTextFont(4);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextPadding(tft.textWidth("100%", 4));
+    tft.drawCentreString(buf, 160, OTA_BAR_Y + OTA_BAR_H + 10, 4);
+    tft.setTextPadding(0);
+}
+
 // Function to format the local time from epoch time
 String formatLocalTime(long epochTime)
 {
@@ -989,26 +1323,9 @@ String convertEpochToTimeString(long epochTime)
     return String(buffer);
 }
 
-// Function to display time (local or UTC) with change detection and custom font color
+// Function to draw time (local or UTC) into the clock face with change detection, fontColor is a palette index
 void displayTime(int x, int y, String time, String &previousTime, int yOffset, uint16_t fontColor)
 {
-    if (refreshDigits)
-    {
-        refreshDigitsCounter++;
-        if (refreshDigitsCounter == 1)
-        {
-            // First call — force clear by using empty string
-            previousTime = "";
-        }
-        else if (refreshDigitsCounter >= 2)
-        {
-            // Second call — stop refreshing
-            previousTime = "";
-            refreshDigits = false;
-            refreshDigitsCounter = 0;
-        }
-    }
-
     // Define the calculated positions for each character
     int positions[] = {x, x + 48, x + 78, x + 108, x + 156, x + 186, x + 216, x + 264};
 
@@ -1017,10 +1334,17 @@ void displayTime(int x, int y, String time, String &previousTime, int yOffset, u
     {
         if (time[i] != previousTime[i])
         {
-            tft.setTextColor(TFT_BLACK);
-            tft.drawString(String(previousTime[i]), positions[i], y + yOffset, 1);
-            tft.setTextColor(fontColor);
-            tft.drawString(String(time[i]), positions[i], y + yOffset, 1);
+            if (time[i] == ':')
+            {
+                // Separators sit closer than a character cell to the digits: draw them transparently
+                clockFace.setTextColor(fontColor);
+            }
+            else
+            {
+                // drawString() clears the character cell first, in RAM, so only the new digit is pushed
+                clockFace.setTextColor(fontColor, PAL_BLACK);
+            }
+            clockFace.drawString(String(time[i]), positions[i], y + yOffset, 1);
         }
     }
 
@@ -1040,7 +1364,8 @@ void *fileOpen(const char *filename, int32_t *size)
 
 void fileClose(void *handle)
 {
-    ((fs::File *)handle)->close();
+    if (handle)
+        ((fs::File *)handle)->close();
 }
 
 int32_t fileRead(PNGFILE *handle, uint8_t *buffer, int32_t length)
@@ -1063,24 +1388,41 @@ void displayPNGfromSPIFFS(const char *filename, int duration_ms)
         return;
     }
 
-    int16_t rc = png.open(filename, fileOpen, fileClose, fileRead, fileSeek, [](PNGDRAW *pDraw)
-                          {
+    uint32_t freeHeapBefore = ESP.getFreeHeap();
+    png = new (std::nothrow) PNG();
+    if (png == nullptr)
+    {
+        Serial.printf("❌ Not enough heap for PNG decoder (%u bytes needed)\n", (unsigned)sizeof(PNG));
+        return;
+    }
+
+    int16_t rc = png->open(filename, fileOpen, fileClose, fileRead, fileSeek, [](PNGDRAW *pDraw)
+                           {
     uint16_t lineBuffer[480];  // Adjust to your screen width if needed
-    png.getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, 0xFFFFFFFF);
+    png->getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, 0xFFFFFFFF);
     tft.pushImage(0, pDraw->y, pDraw->iWidth, 1, lineBuffer); });
 
     if (rc == PNG_SUCCESS)
     {
         Serial.printf("Displaying PNG: %s\n", filename);
         tft.startWrite();
-        png.decode(nullptr, 0);
+        png->decode(nullptr, 0);
         tft.endWrite();
+        png->close();
     }
     else
     {
         Serial.println("PNG decode failed.");
     }
 
+    uint32_t freeHeapDuring = ESP.getFreeHeap();
+    delete png;
+    png = nullptr;
+
+    uint32_t freeHeapAfter = ESP.getFreeHeap();
+    Serial.printf("🧹 PNG decoder released: %u bytes reclaimed (free heap %u -> %u -> %u)\n",
+                  (unsigned)(freeHeapAfter - freeHeapDuring), freeHeapBefore, freeHeapDuring, freeHeapAfter);
+
     delay(duration_ms);
 }
 
@@ -1094,6 +1436,43 @@ String convertTimestampToDate(long timestamp)
     return String(buffer);
 }
 
+// Settings stored in /settings.json
+// The file is read into this copy, which is applied to the globals only if it
+// parsed completely, so a truncated file cannot leave the settings half-applied
+struct StoredSettings
+{
+    float latitude;
+    float longitude;
+    uint16_t localTimeColour;
+    uint16_t utcTimeColour;
+    bool doubleFrame;
+    uint16_t localFrameColour;
+    uint16_t utcFrameColour;
+    uint16_t bannerColour;
+    int bannerSpeed;
+    String localTimeLabel;
+    String utcTimeLabel;
+    String startupLogo;
+    bool italicClockFonts;
+};
+StoredSettings storedSettings;
+
+constexpr JsonField settingsFields[] = {
+    {"/latitude", storedSettings.latitude},
+    {"/longitude", storedSettings.longitude},
+    {"/localTimeColour", storedSettings.localTimeColour},
+    {"/utcTimeColour", storedSettings.utcTimeColour},
+    {"/doubleFrame", storedSettings.doubleFrame},
+    {"/localFrameColour", storedSettings.localFrameColour},
+    {"/utcFrameColour", storedSettings.utcFrameColour},
+    {"/bannerColour", storedSettings.bannerColour},
+    {"/bannerSpeed", storedSettings.bannerSpeed},
+    {"/localTimeLabel", storedSettings.localTimeLabel},
+    {"/utcTimeLabel", storedSettings.utcTimeLabel},
+    {"/startupLogo", storedSettings.startupLogo},
+    {"/italicClockFonts", storedSettings.italicClockFonts},
+};
+
 // Load settings from SPIFFS JSON
 void loadSettings()
 {
@@ -1106,30 +1485,33 @@ void loadSettings()
         return;
     }
 
-    StaticJsonDocument<1024> doc;
-    DeserializationError error = deserializeJson(doc, file);
+    // Keys missing from the file keep their current value
+    storedSettings = {latitude, longitude, localTimeColour, utcTimeColour, doubleFrame,
+                      localFrameColour, utcFrameColour, bannerColour, bannerSpeed,
+                      localTimeLabel, utcTimeLabel, startupLogo, italicClockFonts};
+    DeserializationError error = deserializeJson(settingsFields, file);
+    file.close(); // Always close file after use
     if (error)
     {
-        Serial.println("⚠️ Failed to parse settings file. Using defaults.");
-        file.close();
+        Serial.printf("⚠️ Failed to parse settings file (%s). Using defaults.\n", error.c_str());
+        storedSettings = StoredSettings(); // Releases the strings
         return;
     }
 
-    file.close(); // Always close file after use
-
-    latitude = doc["latitude"] | latitude;
-    longitude = doc["longitude"] | longitude;
-    localTimeColour = doc["localTimeColour"] | localTimeColour;
-    utcTimeColour = doc["utcTimeColour"] | utcTimeColour;
-    doubleFrame = doc["doubleFrame"] | doubleFrame;
-    localFrameColour = doc["localFrameColour"] | localFrameColour;
-    utcFrameColour = doc["utcFrameColour"] | utcFrameColour;
-    bannerColour = doc["bannerColour"] | bannerColour;
-    bannerSpeed = doc["bannerSpeed"] | bannerSpeed;
-    localTimeLabel = doc["localTimeLabel"] | localTimeLabel;
-    utcTimeLabel = doc["utcTimeLabel"] | utcTimeLabel;
-    startupLogo = doc["startupLogo"] | startupLogo;
-    italicClockFonts = doc["italicClockFonts"] | italicClockFonts;
+    latitude = storedSettings.latitude;
+    longitude = storedSettings.longitude;
+    localTimeColour = storedSettings.localTimeColour;
+    utcTimeColour = storedSettings.utcTimeColour;
+    doubleFrame = storedSettings.doubleFrame;
+    localFrameColour = storedSettings.localFrameColour;
+    utcFrameColour = storedSettings.utcFrameColour;
+    bannerColour = storedSettings.bannerColour;
+    bannerSpeed = storedSettings.bannerSpeed;
+    localTimeLabel = storedSettings.localTimeLabel;
+    utcTimeLabel = storedSettings.utcTimeLabel;
+    startupLogo = storedSettings.startupLogo;
+    italicClockFonts = storedSettings.italicClockFonts;
+    storedSettings = StoredSettings();
 
     Serial.println("✅ Settings loaded from SPIFFS:");
     Serial.printf("📍 latitude: %.6f\n", latitude);
@@ -1151,7 +1533,8 @@ void loadSettings()
 
 void saveSettings()
 {
-    StaticJsonDocument<1024> doc;
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
     doc["latitude"] = latitude;
     doc["longitude"] = longitude;
     doc["localTimeColour"] = localTimeColour;
@@ -1231,39 +1614,212 @@ void drawOrredrawStaticElements()
     }
     previousLocalTime = "";
     previousUTCtime = "";
-    tft.setFreeFont(&Orbitron_Medium8pt7b);
-    tft.fillRect(25, 0 + 85 - 10, 270, 20, TFT_BLACK);
-    tft.fillRect(25, 106 + 85 - 10, 270, 20, TFT_BLACK);
+    clockFace.setFreeFont(&Orbitron_Medium8pt7b);
+    clockFace.fillRect(25, 0 + 85 - 10, 270, 20, PAL_BLACK);
+    clockFace.fillRect(25, 106 + 85 - 10, 270, 20, PAL_BLACK);
 
     // 🟩 Local Frame
-    tft.fillRect(0, 0, 320, 87, TFT_BLACK); // Clear previous frame
-    tft.drawRoundRect(1, 1, 318, 85, 4, TFT_BLACK);
+    clockFace.fillRect(0, 0, 320, 87, PAL_BLACK); // Clear previous frame
+    clockFace.drawRoundRect(1, 1, 318, 85, 4, PAL_BLACK);
 
-    tft.drawRoundRect(0, 0, 320, 87, 5, localFrameColour);
+    clockFace.drawRoundRect(0, 0, 320, 87, 5, PAL_LOCAL_FRAME);
     if (doubleFrame)
     {
-        tft.drawRoundRect(1, 1, 318, 85, 4, localFrameColour);
-        tft.drawRoundRect(2, 2, 316, 83, 4, localFrameColour);
-        tft.drawRoundRect(3, 3, 314, 81, 4, localFrameColour);
+        clockFace.drawRoundRect(1, 1, 318, 85, 4, PAL_LOCAL_FRAME);
+        clockFace.drawRoundRect(2, 2, 316, 83, 4, PAL_LOCAL_FRAME);
+        clockFace.drawRoundRect(3, 3, 314, 81, 4, PAL_LOCAL_FRAME);
     }
 
     // 🟦 Local Time Label
 
-    tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
-    tft.drawCentreString(localTimeLabel, 160, 76, 1);
+    clockFace.setTextColor(PAL_LABEL, PAL_BLACK);
+    clockFace.drawCentreString(localTimeLabel, 160, 76, 1);
 
     // 🟥 UTC Frame
-    tft.fillRect(0, 105, 320, 87, TFT_BLACK); // Clear previous frame
-    tft.drawRoundRect(1, 106, 318, 85, 4, TFT_BLACK);
+    clockFace.fillRect(0, 105, 320, 87, PAL_BLACK); // Clear previous frame
+    clockFace.drawRoundRect(1, 106, 318, 85, 4, PAL_BLACK);
 
-    tft.drawRoundRect(0, 105, 320, 87, 5, utcFrameColour);
+    clockFace.drawRoundRect(0, 105, 320, 87, 5, PAL_UTC_FRAME);
     if (doubleFrame)
     {
-        tft.drawRoundRect(1, 106, 318, 85, 4, utcFrameColour);
-        tft.drawRoundRect(2, 107, 316, 83, 4, utcFrameColour);
-        tft.drawRoundRect(3, 108, 314, 81, 4, utcFrameColour);
+        clockFace.drawRoundRect(1, 106, 318, 85, 4, PAL_UTC_FRAME);
+        clockFace.drawRoundRect(2, 107, 316, 83, 4, PAL_UTC_FRAME);
+        clockFace.drawRoundRect(3, 108, 314, 81, 4, PAL_UTC_FRAME);
     }
 
     // ⬜ UTC Label
-    tft.drawCentreString(utcTimeLabel, 160, 76 + 105, 1);
+    clockFace.drawCentreString(utcTimeLabel, 160, 76 + 105, 1);
+}
+
+// Load the clock face palette from the colour settings, changed entries mark the frame buffer for a push
+void updateClockPalette()
+{
+    clockFace.setPaletteColor(PAL_BLACK, TFT_BLACK);
+    clockFace.setPaletteColor(PAL_LOCAL_TIME, localTimeColour);
+    clockFace.setPaletteColor(PAL_UTC_TIME, utcTimeColour);
+    clockFace.setPaletteColor(PAL_LOCAL_FRAME, localFrameColour);
+    clockFace.setPaletteColor(PAL_UTC_FRAME, utcFrameColour);
+    clockFace.setPaletteColor(PAL_LABEL, TFT_DARKGREY);
+}
+
+// Start recording a new boot trace in RTC memory
+void bootProfilerBegin()
+{
+    uint32_t nowUs = micros();
+
+    // RTC_NOINIT memory holds garbage after a power cycle
+    if (bootTraceStore.magic != BOOT_TRACE_MAGIC || bootTraceStore.current >= BOOT_TRACE_HISTORY)
+    {
+        memset(&bootTraceStore, 0, sizeof(bootTraceStore));
+        bootTraceStore.magic = BOOT_TRACE_MAGIC;
+        bootTraceStore.current = BOOT_TRACE_HISTORY - 1;
+    }
+
+    bootTraceStore.bootCount++;
+    bootTraceStore.current = (bootTraceStore.current + 1) % BOOT_TRACE_HISTORY;
+
+    BootTrace &trace = bootTraceStore.traces[bootTraceStore.current];
+    memset(&trace, 0, sizeof(trace));
+    trace.bootNumber = bootTraceStore.bootCount;
+    trace.setupStartUs = nowUs;
+    trace.resetReason = (uint8_t)esp_reset_reason();
+
+    bootPhaseStartUs = nowUs;
+    bootProfilerDone = false;
+}
+
+// Close the current phase: everything since the previous mark is accounted to `name`
+void bootPhase(const char *name)
+{
+    if (bootProfilerDone)
+        return;
+
+    uint32_t nowUs = micros();
+    BootTrace &trace = bootTraceStore.traces[bootTraceStore.current];
+    if (trace.phaseCount < BOOT_TRACE_MAX_PHASES)
+    {
+        BootPhase &phase = trace.phases[trace.phaseCount++];
+        strlcpy(phase.name, name, sizeof(phase.name));
+        phase.startUs = bootPhaseStartUs - trace.setupStartUs;
+        phase.durationUs = nowUs - bootPhaseStartUs;
+        Serial.printf("⏱️ Boot phase %-12s %8.3f ms\n", phase.name, phase.durationUs / 1000.0);
+    }
+    bootPhaseStartUs = nowUs;
+}
+
+// Mark the boot as complete and print the total
+void bootProfilerEnd()
+{
+    if (bootProfilerDone)
+        return;
+
+    BootTrace &trace = bootTraceStore.traces[bootTraceStore.current];
+    trace.totalUs = micros() - trace.setupStartUs;
+    bootProfilerDone = true;
+    Serial.printf("⏱️ Boot #%u complete: %.3f ms after setup() (%.3f ms after power-on)\n",
+                  trace.bootNumber, trace.totalUs / 1000.0, (trace.setupStartUs + trace.totalUs) / 1000.0);
+}
+
+// Serve the stored boot traces, most recent first
+void handleBootTrace()
+{
+    ArenaScope jsonScope(jsonArena);
+    JsonDocument doc(&jsonArena);
+    doc["bootCount"] = bootTraceStore.bootCount;
+    JsonArray traces = doc["traces"].to<JsonArray>();
+
+    for (int i = 0; i < BOOT_TRACE_HISTORY; i++)
+    {
+        int index = (bootTraceStore.current + BOOT_TRACE_HISTORY - i) % BOOT_TRACE_HISTORY;
+        const BootTrace &trace = bootTraceStore.traces[index];
+        if (trace.bootNumber == 0)
+            continue; // Slot never used
+
+        JsonObject t = traces.add<JsonObject>();
+        t["boot"] = trace.bootNumber;
+        t["resetReason"] = trace.resetReason;
+        t["setupStartUs"] = trace.setupStartUs;
+        t["totalUs"] = trace.totalUs;
+        JsonArray phases = t["phases"].to<JsonArray>();
+        for (int p = 0; p < trace.phaseCount && p < BOOT_TRACE_MAX_PHASES; p++)
+        {
+            JsonObject phase = phases.add<JsonObject>();
+            phase["name"] = trace.phases[p].name;
+            phase["startUs"] = trace.phases[p].startUs;
+            phase["durationUs"] = trace.phases[p].durationUs;
+        }
+    }
+
+    sendDocument(doc);
+}
+
+// Restore time and weather from the RTC snapshot left by a software reset
+// Returns false on a cold boot
+bool restoreWarmSnapshot()
+{
+    uint32_t crc = crc32_le(0, (const uint8_t *)&warmSnapshot, offsetof(WarmSnapshot, crc));
+    if (esp_reset_reason() == ESP_RST_POWERON || warmSnapshot.magic != WARM_SNAPSHOT_MAGIC || warmSnapshot.crc != crc)
+    {
+        // Cold boot: RTC memory holds garbage, start with an empty snapshot
+        memset(&warmSnapshot, 0, sizeof(warmSnapshot));
+        warmSnapshot.magic = WARM_SNAPSHOT_MAGIC;
+        saveWarmSnapshot();
+        Serial.println("🧊 Cold boot: no warm-restart snapshot");
+        return false;
+    }
+
+    if (warmSnapshot.epoch != 0 && time(nullptr) < MIN_VALID_EPOCH)
+    {
+        // Advance the last NTP time by the RTC time elapsed since, corrected for drift
+        int64_t elapsedUs = (int64_t)(esp_rtc_get_time_us() - warmSnapshot.rtcUs);
+        elapsedUs -= elapsedUs / 1000000 * warmSnapshot.driftPpm;
+        struct timeval tv = {(time_t)(warmSnapshot.epoch + elapsedUs / 1000000), (suseconds_t)(elapsedUs % 1000000)};
+        settimeofday(&tv, nullptr);
+        Serial.printf("♨️ Time restored from snapshot (%lld s since last NTP sync, drift %d ppm)\n",
+                      elapsedUs / 1000000, warmSnapshot.driftPpm);
+    }
+
+    if (warmSnapshot.hasWeather)
+    {
+        lastWeather = warmSnapshot.weather;
+        scrollText = warmSnapshot.scrollText;
+        Serial.printf("♨️ Weather restored from snapshot: %s\n", scrollText.c_str());
+    }
+    return true;
+}
+
+// Copy the current weather and banner into the snapshot and reseal it
+void saveWarmSnapshot()
+{
+    warmSnapshot.magic = WARM_SNAPSHOT_MAGIC;
+    if (warmSnapshot.hasWeather)
+    {
+        warmSnapshot.weather = lastWeather;
+        strlcpy(warmSnapshot.scrollText, scrollText.c_str(), sizeof(warmSnapshot.scrollText));
+    }
+    warmSnapshot.crc = crc32_le(0, (const uint8_t *)&warmSnapshot, offsetof(WarmSnapshot, crc));
+}
+
+// Called on every NTP update: sets the system clock and refines the RTC drift estimate
+void recordNtpSync(time_t epoch)
+{
+    struct timeval tv = {epoch, 0};
+    settimeofday(&tv, nullptr);
+
+    uint64_t nowUs = esp_rtc_get_time_us();
+    if (warmSnapshot.epoch != 0 && nowUs - warmSnapshot.rtcUs < DRIFT_MIN_INTERVAL_US)
+        return; // Keep the older reference so the drift is measured over a long span
+
+    if (warmSnapshot.epoch != 0)
+    {
+        // Positive drift: the RTC timer runs fast compared to NTP
+        int64_t elapsedUs = (int64_t)(nowUs - warmSnapshot.rtcUs);
+        int64_t errorUs = elapsedUs - (int64_t)(epoch - warmSnapshot.epoch) * 1000000;
+        int32_t ppm = (int32_t)(errorUs * 1000000 / elapsedUs);
+        warmSnapshot.driftPpm = (warmSnapshot.driftPpm * 3 + ppm) / 4; // Smooth out the 1 s NTP resolution
+    }
+
+    warmSnapshot.epoch = epoch;
+    warmSnapshot.rtcUs = nowUs;
+    saveWarmSnapshot();
 }